@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2014-2020 Patrizio Bekerle -- <patrizio@bekerle.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+
+/*
+ * Benchmarks for the hot paths of the highlighter, the search widget and
+ * the editor
+ *
+ * The corpora are generated, so the numbers are reproducible. Run a single
+ * benchmark with e.g. "qmarkdowntextedit-bench highlightDocument:tables",
+ * see "qmarkdowntextedit-bench -help" for the QtTest options.
+ */
+
+#include <QLineEdit>
+#include <QPlainTextEdit>
+#include <QTextBlock>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QtTest>
+
+#include "markdownhighlighter.h"
+#include "qmarkdowntextedit.h"
+#include "qplaintexteditsearchwidget.h"
+
+namespace {
+
+/**
+ * @brief Gives access to the code languages of the highlighter
+ */
+class BenchHighlighter : public MarkdownHighlighter {
+   public:
+    using MarkdownHighlighter::MarkdownHighlighter;
+
+    static QStringList codeLanguages() {
+        if (_langStringToEnum.isEmpty()) {
+            initCodeLangs();
+        }
+
+        QStringList languages = _langStringToEnum.keys();
+        languages.sort();
+        return languages;
+    }
+};
+
+/**
+ * @brief Repeats part until the text is at least size characters long
+ */
+QString repeated(const QString &part, int size) {
+    QString text;
+    text.reserve(size + part.size());
+    while (text.size() < size) {
+        text += part;
+    }
+    return text;
+}
+
+QString proseCorpus(int size) {
+    return repeated(
+        QStringLiteral(
+            "# A headline\n\n"
+            "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+            "eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut "
+            "enim ad minim veniam, quis nostrud exercitation ullamco.\n\n"
+            "Duis aute irure dolor in reprehenderit in voluptate velit esse "
+            "cillum dolore eu fugiat nulla pariatur.\n\n"
+            "- a list item\n- another list item\n\n"
+            "> a block quote\n\n"),
+        size);
+}
+
+QString emphasisCorpus(int size) {
+    return repeated(
+        QStringLiteral(
+            "Some *italic*, **bold**, ***both***, _under_ and __score__ "
+            "with `code`, ~~strike~~ and a [link](http://example.com), "
+            "*nested **strong** text* and **an *emphasis* inside**.\n"
+            "Unmatched * and _ and ` delimiters, <http://example.com> and "
+            "![an image](image.png) and some <b>html</b>.\n\n"),
+        size);
+}
+
+QString tableCorpus(int size) {
+    QString table = QStringLiteral("| Name | Value | Description |\n"
+                                   "| ---- | :---: | ----------- |\n");
+    for (int i = 0; i < 50; ++i) {
+        table +=
+            QStringLiteral("| row %1 | **%1** | some `code` and *text* |\n")
+                .arg(i);
+    }
+    table += QLatin1Char('\n');
+    return repeated(table, size);
+}
+
+QString codeCorpus(int size) {
+    QString text;
+    const QStringList languages = BenchHighlighter::codeLanguages();
+    for (const QString &language : languages) {
+        text += QStringLiteral("```") + language +
+                QStringLiteral(
+                    "\n"
+                    "// a comment\n"
+                    "int main(int argc, char *argv[]) {\n"
+                    "    const char *text = \"a string\";\n"
+                    "    for (int i = 0; i < 0x10; ++i) { return 42; }\n"
+                    "}\n"
+                    "key: value # yaml\n"
+                    "<tag attribute=\"value\">text</tag>\n"
+                    "```\n\n");
+    }
+    return repeated(text, size);
+}
+
+/**
+ * @brief A plain text with a match of "needle" in every other line
+ */
+QString searchCorpus(int size) {
+    return repeated(
+        QStringLiteral("the quick brown fox jumps over the lazy dog\n"
+                       "a needle in the haystack, NEEDLE and Needles\n"),
+        size);
+}
+
+}    // namespace
+
+class MarkdownBenchmark : public QObject {
+    Q_OBJECT
+
+   private slots:
+    void highlightDocument_data();
+    void highlightDocument();
+    void rehighlightKeystroke_data();
+    void rehighlightKeystroke();
+    void searchCount_data();
+    void searchCount();
+    void replaceAll_data();
+    void replaceAll();
+    void markdownUrlAtPosition();
+};
+
+static void addCorpusRows() {
+    QTest::addColumn<QString>("text");
+
+    constexpr int size = 1024 * 1024;
+    QTest::newRow("prose") << proseCorpus(size);
+    QTest::newRow("emphasis") << emphasisCorpus(size);
+    QTest::newRow("tables") << tableCorpus(size);
+    QTest::newRow("code") << codeCorpus(size);
+}
+
+void MarkdownBenchmark::highlightDocument_data() { addCorpusRows(); }
+
+/**
+ * @brief Highlights a whole 1 MB document
+ */
+void MarkdownBenchmark::highlightDocument() {
+    QFETCH(QString, text);
+
+    QTextDocument document;
+    document.setPlainText(text);
+    MarkdownHighlighter highlighter(&document);
+
+    QBENCHMARK { highlighter.rehighlight(); }
+}
+
+void MarkdownBenchmark::rehighlightKeystroke_data() { addCorpusRows(); }
+
+/**
+ * @brief Types and removes a character in the middle of a highlighted
+ * document, like a keystroke and a backspace
+ */
+void MarkdownBenchmark::rehighlightKeystroke() {
+    QFETCH(QString, text);
+
+    QTextDocument document;
+    document.setPlainText(text);
+    MarkdownHighlighter highlighter(&document);
+
+    QTextCursor cursor(document.findBlockByNumber(document.blockCount() / 2));
+    cursor.movePosition(QTextCursor::EndOfBlock);
+
+    QBENCHMARK {
+        cursor.insertText(QStringLiteral("*"));
+        cursor.deletePreviousChar();
+    }
+}
+
+void MarkdownBenchmark::searchCount_data() {
+    QTest::addColumn<int>("size");
+    QTest::addColumn<int>("searchMode");
+
+    for (const int megabytes : {1, 10, 100}) {
+        const int size = megabytes * 1024 * 1024;
+        QTest::addRow("%d MB plain", megabytes)
+            << size << int(QPlainTextEditSearchWidget::PlainTextMode);
+        QTest::addRow("%d MB whole words", megabytes)
+            << size << int(QPlainTextEditSearchWidget::WholeWordsMode);
+        QTest::addRow("%d MB regex", megabytes)
+            << size << int(QPlainTextEditSearchWidget::RegularExpressionMode);
+    }
+}
+
+/**
+ * @brief Counts the matches of a search in a plain text edit
+ */
+void MarkdownBenchmark::searchCount() {
+    QFETCH(int, size);
+    QFETCH(int, searchMode);
+
+    QPlainTextEdit textEdit;
+    textEdit.setPlainText(searchCorpus(size));
+    QPlainTextEditSearchWidget searchWidget(&textEdit);
+    searchWidget.setSearchMode(
+        QPlainTextEditSearchWidget::SearchMode(searchMode));
+    searchWidget.setSearchText(
+        searchMode == QPlainTextEditSearchWidget::RegularExpressionMode
+            ? QStringLiteral("ne+dle")
+            : QStringLiteral("needle"));
+
+    QBENCHMARK { searchWidget.doSearchCount(); }
+}
+
+void MarkdownBenchmark::replaceAll_data() {
+    QTest::addColumn<int>("searchMode");
+
+    QTest::newRow("plain") << int(QPlainTextEditSearchWidget::PlainTextMode);
+    QTest::newRow("regex")
+        << int(QPlainTextEditSearchWidget::RegularExpressionMode);
+}
+
+/**
+ * @brief Replaces about 50000 matches and undoes the replacement
+ */
+void MarkdownBenchmark::replaceAll() {
+    QFETCH(int, searchMode);
+
+    QPlainTextEdit textEdit;
+    textEdit.setPlainText(searchCorpus(2 * 1024 * 1024));
+    QPlainTextEditSearchWidget searchWidget(&textEdit);
+    searchWidget.setSearchMode(
+        QPlainTextEditSearchWidget::SearchMode(searchMode));
+    searchWidget.setSearchText(
+        searchMode == QPlainTextEditSearchWidget::RegularExpressionMode
+            ? QStringLiteral("(ne+)dle")
+            : QStringLiteral("needle"));
+
+    auto *replaceLineEdit =
+        searchWidget.findChild<QLineEdit *>(QStringLiteral("replaceLineEdit"));
+    QVERIFY(replaceLineEdit != nullptr);
+    replaceLineEdit->setText(
+        searchMode == QPlainTextEditSearchWidget::RegularExpressionMode
+            ? QStringLiteral("p\\1dle")
+            : QStringLiteral("pin"));
+
+    QBENCHMARK {
+        searchWidget.doReplaceAll();
+        textEdit.undo();
+    }
+}
+
+/**
+ * @brief Resolves the url under the cursor in a line with links in a
+ * document with many reference definitions
+ */
+void MarkdownBenchmark::markdownUrlAtPosition() {
+    QString text = proseCorpus(256 * 1024);
+    for (int i = 0; i < 1000; ++i) {
+        text += QStringLiteral("[ref%1]: http://example.com/%1\n").arg(i);
+    }
+
+    QMarkdownTextEdit textEdit;
+    textEdit.setPlainText(text);
+    textEdit.highlighter()->rehighlight();
+
+    const QString line = QStringLiteral(
+        "See <http://example.com>, [the docs](http://example.com/docs), "
+        "http://example.com/plain and [a reference][ref500] or [more][ref1]");
+    const int position = line.indexOf(QStringLiteral("reference"));
+
+    QString url;
+    QBENCHMARK { url = textEdit.getMarkdownUrlAtPosition(line, position); }
+    QCOMPARE(url, QStringLiteral("http://example.com/500"));
+}
+
+QTEST_MAIN(MarkdownBenchmark)
+
+#include "qmarkdowntextedit-bench.moc"
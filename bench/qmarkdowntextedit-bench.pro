@@ -0,0 +1,8 @@
+TARGET   = qmarkdowntextedit-bench
+TEMPLATE = app
+QT += core gui widgets concurrent testlib
+CONFIG += c++11
+
+include(../qmarkdowntextedit.pri)
+
+SOURCES += qmarkdowntextedit-bench.cpp
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2014-2020 Patrizio Bekerle -- <patrizio@bekerle.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * Cache of tokenizer results for the markdown highlighter
+ */
+
+#include "markdownhighlightcache.h"
+
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+#include <algorithm>
+
+namespace {
+
+// bump when the file layout or the tokenizer output changes
+constexpr quint32 cacheFileMagic = 0x4d484331;  // "MHC1"
+constexpr quint32 cacheFileVersion = 4;
+
+// the fewest bytes the records of a file take, a count that needs more
+// than are left is corrupt and nothing is reserved for it
+constexpr qint64 minRangeSize = 3 * sizeof(qint32);
+// start, length and the type and empty property map of the format
+constexpr qint64 minFormatSize = 4 * sizeof(qint32);
+// the counts, states, flag, null strings and degradation of a result
+constexpr qint64 minResultSize = 9 * sizeof(qint32) + 1;
+// the key and a result
+constexpr qint64 minEntrySize = sizeof(quint64) + minResultSize;
+
+constexpr quint64 fnvOffsetBasis = 14695981039346656037ULL;
+constexpr quint64 fnvPrime = 1099511628211ULL;
+
+inline quint64 hashValue(quint64 hash, quint64 value) {
+    hash ^= value;
+    return hash * fnvPrime;
+}
+
+/**
+ * @brief FNV-1a over the UTF-16 code units, the length keeps the strings
+ * of a key apart
+ */
+quint64 hashString(quint64 hash, const QString &text) {
+    const ushort *data = text.utf16();
+    const int length = text.length();
+
+    for (int i = 0; i < length; ++i) {
+        hash = hashValue(hash, data[i]);
+    }
+
+    return hashValue(hash, static_cast<quint64>(length));
+}
+
+void writeRanges(QDataStream &out,
+                 const QVector<MarkdownHighlighter::InlineRange> &ranges) {
+    out << static_cast<qint32>(ranges.size());
+    for (const auto &range : ranges) {
+        out << static_cast<qint32>(range.begin)
+            << static_cast<qint32>(range.end)
+            << static_cast<qint32>(range.type);
+    }
+}
+
+/**
+ * @brief Returns true if count records of at least minSize bytes can still
+ * be in the stream
+ */
+bool canHoldRecords(QDataStream &in, qint32 count, qint64 minSize) {
+    return count >= 0 && in.status() == QDataStream::Ok &&
+           count <= in.device()->bytesAvailable() / minSize;
+}
+
+bool readRanges(QDataStream &in,
+                QVector<MarkdownHighlighter::InlineRange> &ranges) {
+    qint32 size = 0;
+    in >> size;
+    if (!canHoldRecords(in, size, minRangeSize)) {
+        return false;
+    }
+
+    ranges.reserve(size);
+    for (qint32 i = 0; i < size; ++i) {
+        qint32 begin = 0;
+        qint32 end = 0;
+        qint32 type = 0;
+        in >> begin >> end >> type;
+        if (in.status() != QDataStream::Ok) {
+            return false;
+        }
+        ranges.append(MarkdownHighlighter::InlineRange(
+            begin, end, static_cast<MarkdownHighlighter::RangeType>(type)));
+    }
+
+    return in.status() == QDataStream::Ok;
+}
+
+void writeResult(QDataStream &out,
+                 const MarkdownHighlighter::BlockResult &result) {
+    out << static_cast<qint32>(result.formats.size());
+    for (const auto &range : result.formats) {
+        out << static_cast<qint32>(range.start)
+            << static_cast<qint32>(range.length) << range.format;
+    }
+
+    writeRanges(out, result.ranges.codeSpans);
+    writeRanges(out, result.ranges.emphasisByBegin);
+    writeRanges(out, result.ranges.emphasisByEnd);
+
+    out << static_cast<qint32>(result.state)
+        << static_cast<qint32>(result.previousState)
+        << result.previousStateChanged << result.referenceId
+        << result.referenceUrl << static_cast<qint32>(result.degradation);
+}
+
+bool readResult(QDataStream &in, MarkdownHighlighter::BlockResult &result) {
+    qint32 size = 0;
+    in >> size;
+    if (!canHoldRecords(in, size, minFormatSize)) {
+        return false;
+    }
+
+    result.formats.reserve(size);
+    for (qint32 i = 0; i < size; ++i) {
+        qint32 start = 0;
+        qint32 length = 0;
+        QTextFormat format;
+        in >> start >> length >> format;
+        if (in.status() != QDataStream::Ok) {
+            return false;
+        }
+        result.formats.append({start, length, format.toCharFormat()});
+    }
+
+    if (!readRanges(in, result.ranges.codeSpans) ||
+        !readRanges(in, result.ranges.emphasisByBegin) ||
+        !readRanges(in, result.ranges.emphasisByEnd)) {
+        return false;
+    }
+
+    qint32 state = 0;
+    qint32 previousState = 0;
+    qint32 degradation = 0;
+    in >> state >> previousState >> result.previousStateChanged >>
+        result.referenceId >> result.referenceUrl >> degradation;
+    result.state = state;
+    result.previousState = previousState;
+    result.degradation =
+        static_cast<MarkdownHighlighter::Degradation>(degradation);
+
+    return in.status() == QDataStream::Ok;
+}
+
+}  // namespace
+
+/**
+ * @brief Creates an empty cache
+ *
+ * @param maxBytes the approximate memory budget of the cached results
+ */
+MarkdownHighlightCache::MarkdownHighlightCache(int maxBytes)
+    : _cache(maxBytes),
+      _formatsFingerprint(MarkdownHighlighter::formatsFingerprint()) {}
+
+/**
+ * @brief Returns the cache key of a tokenizer input
+ *
+ * The tokenizer looks at the previous and next block too, so they are part
+ * of the key. The time budget isn't, results that exceeded it must not be
+ * inserted.
+ */
+quint64 MarkdownHighlightCache::key(
+    const MarkdownHighlighter::BlockInput &input,
+    MarkdownHighlighter::HighlightingOptions options) {
+    quint64 hash = fnvOffsetBasis;
+    hash = hashString(hash, input.text);
+    hash = hashString(hash, input.previousText);
+    hash = hashString(hash, input.nextText);
+    hash = hashValue(hash, static_cast<quint32>(input.previousState));
+    hash = hashValue(hash, input.blockNumber == 0 ? 1 : 0);
+    hash = hashValue(hash, static_cast<quint32>(input.degradation));
+    return hashValue(hash, static_cast<quint32>(options));
+}
+
+/**
+ * @brief Returns the cached result for a key or nullptr, the result stays
+ * valid until the cache is changed
+ */
+const MarkdownHighlighter::BlockResult *MarkdownHighlightCache::find(
+    quint64 key) {
+    checkFormats();
+    return _cache.object(key);
+}
+
+/**
+ * @brief Caches a tokenizer result, the least recently used results are
+ * dropped when the budget is exceeded
+ */
+void MarkdownHighlightCache::insert(
+    quint64 key, const MarkdownHighlighter::BlockResult &result) {
+    checkFormats();
+
+    auto *cached = new MarkdownHighlighter::BlockResult(result);
+#ifdef MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+    // replaying a result costs no tokenizing time
+    std::fill(cached->phaseNsecs,
+              cached->phaseNsecs + MarkdownHighlighter::Stats::PhaseCount, 0);
+    cached->syntaxState = MarkdownHighlighter::NoState;
+#endif
+    _cache.insert(key, cached, cost(*cached));
+}
+
+void MarkdownHighlightCache::clear() { _cache.clear(); }
+
+/**
+ * @brief Sets the approximate memory budget, results are dropped right
+ * away if it shrinks
+ */
+void MarkdownHighlightCache::setMaxBytes(int maxBytes) {
+    _cache.setMaxCost(maxBytes);
+}
+
+/**
+ * @brief Writes the cached results to a file
+ *
+ * @return false if the file couldn't be written
+ */
+bool MarkdownHighlightCache::save(const QString &fileName) const {
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_6);
+    out << cacheFileMagic << cacheFileVersion << _formatsFingerprint;
+
+    const QList<quint64> keys = _cache.keys();
+    out << static_cast<qint32>(keys.size());
+    for (const quint64 key : keys) {
+        out << key;
+        writeResult(out, *_cache.object(key));
+    }
+
+    return out.status() == QDataStream::Ok && file.commit();
+}
+
+/**
+ * @brief Adds the results of a file written by save()
+ *
+ * Files of another version or written with other text formats are ignored.
+ *
+ * @return false if the file couldn't be used
+ */
+bool MarkdownHighlightCache::load(const QString &fileName) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_6);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QByteArray formatsFingerprint;
+    in >> magic >> version >> formatsFingerprint;
+
+    checkFormats();
+    if (in.status() != QDataStream::Ok || magic != cacheFileMagic ||
+        version != cacheFileVersion ||
+        formatsFingerprint != _formatsFingerprint) {
+        return false;
+    }
+
+    qint32 count = 0;
+    in >> count;
+    if (!canHoldRecords(in, count, minEntrySize)) {
+        return false;
+    }
+
+    for (qint32 i = 0; i < count; ++i) {
+        quint64 key = 0;
+        in >> key;
+
+        auto *result = new MarkdownHighlighter::BlockResult;
+        if (in.status() != QDataStream::Ok || !readResult(in, *result)) {
+            delete result;
+            return false;
+        }
+
+        _cache.insert(key, result, cost(*result));
+    }
+
+    return true;
+}
+
+/**
+ * @brief Drops all results if the text formats changed since they were
+ * computed
+ */
+void MarkdownHighlightCache::checkFormats() {
+    const QByteArray fingerprint = MarkdownHighlighter::formatsFingerprint();
+    if (fingerprint != _formatsFingerprint) {
+        _cache.clear();
+        _formatsFingerprint = fingerprint;
+    }
+}
+
+/**
+ * @brief Returns the approximate memory use of a result, the formats
+ * themselves are shared with the highlighter
+ */
+int MarkdownHighlightCache::cost(
+    const MarkdownHighlighter::BlockResult &result) {
+    const auto &ranges = result.ranges;
+    const int rangeCount = ranges.codeSpans.size() +
+                           ranges.emphasisByBegin.size() +
+                           ranges.emphasisByEnd.size();
+
+    return static_cast<int>(
+        sizeof(MarkdownHighlighter::BlockResult) + sizeof(quint64) +
+        result.formats.size() * sizeof(MarkdownHighlighter::FormatRange) +
+        rangeCount * sizeof(MarkdownHighlighter::InlineRange) +
+        (result.referenceId.size() + result.referenceUrl.size()) *
+            sizeof(QChar));
+}
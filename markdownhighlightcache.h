@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2014-2020 Patrizio Bekerle -- <patrizio@bekerle.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * Cache of tokenizer results for the markdown highlighter
+ */
+
+#pragma once
+
+#include <QCache>
+
+#include "markdownhighlighter.h"
+
+/**
+ * @brief Least recently used cache of tokenizer results, keyed by a hash of
+ * everything the tokenizer looks at
+ *
+ * A cache can be shared by several highlighters, e.g. to replay the
+ * highlighting of a note that is opened again. It can be saved to disk to
+ * survive restarts.
+ */
+class MarkdownHighlightCache {
+   public:
+    explicit MarkdownHighlightCache(int maxBytes = defaultMaxBytes);
+
+    static quint64 key(const MarkdownHighlighter::BlockInput &input,
+                       MarkdownHighlighter::HighlightingOptions options);
+    const MarkdownHighlighter::BlockResult *find(quint64 key);
+    void insert(quint64 key, const MarkdownHighlighter::BlockResult &result);
+    void clear();
+    void setMaxBytes(int maxBytes);
+    int maxBytes() const { return _cache.maxCost(); }
+    int usedBytes() const { return _cache.totalCost(); }
+    int count() const { return _cache.count(); }
+    bool save(const QString &fileName) const;
+    bool load(const QString &fileName);
+
+    static constexpr int defaultMaxBytes = 16 * 1024 * 1024;
+
+   private:
+    void checkFormats();
+    static int cost(const MarkdownHighlighter::BlockResult &result);
+
+    QCache<quint64, MarkdownHighlighter::BlockResult> _cache;
+    // the text formats the results were computed with
+    QByteArray _formatsFingerprint;
+};
@@ -16,21 +16,68 @@
  */
 
 #include "markdownhighlighter.h"
+#include "markdownhighlightcache.h"
 #include "qownlanguagedata.h"
 
+#include <QCryptographicHash>
+#include <QDataStream>
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
 #include <QRegularExpressionMatchIterator>
 #include <QTextDocument>
+#include <QTextLayout>
 #include <QTimer>
+#include <QtConcurrent>
+#include <algorithm>
 #include <utility>
 
+#ifdef MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+#include <chrono>
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#ifdef MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+namespace {
+/**
+ * @brief Adds the time until the end of its scope to nsecs
+ */
+class PhaseTimer {
+   public:
+    explicit PhaseTimer(qint64 &nsecs)
+        : _nsecs(nsecs), _start(std::chrono::steady_clock::now()) {}
+    ~PhaseTimer() {
+        _nsecs += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - _start)
+                      .count();
+    }
+
+   private:
+    qint64 &_nsecs;
+    const std::chrono::steady_clock::time_point _start;
+};
+}    // namespace
+
+// measures the rest of the function into a phase of the tokenizer
+#define MEASURE_PHASE(phase) PhaseTimer phaseTimer(_phaseNsecs[phase])
+#else
+#define MEASURE_PHASE(phase)
+#endif
+
 QHash<QString, MarkdownHighlighter::HighlighterState>
     MarkdownHighlighter::_langStringToEnum;
 QHash<MarkdownHighlighter::HighlighterState, QTextCharFormat>
     MarkdownHighlighter::_formats;
+MarkdownHighlighter::FormatTable MarkdownHighlighter::_formatTable;
 QVector<MarkdownHighlighter::HighlightingRule> MarkdownHighlighter::_highlightingRules;
+int MarkdownHighlighter::_formatsGeneration = 0;
+QVector<QFuture<void>> MarkdownHighlighter::_concurrentJobs;
 
 /**
  * Markdown syntax highlighting
@@ -39,65 +86,419 @@ QVector<MarkdownHighlighter::HighlightingRule> MarkdownHighlighter::_highlightin
  */
 MarkdownHighlighter::MarkdownHighlighter(
     QTextDocument *parent, HighlightingOptions highlightingOptions)
-    : QSyntaxHighlighter(parent), _highlightingOptions(highlightingOptions) {
+    : QSyntaxHighlighter(parent),
+      _highlightingFinished(false),
+      _highlightingOptions(highlightingOptions),
+      _rehighlightTimeBudget(defaultRehighlightTimeBudget),
+      _dirtyBlockCount(0),
+      _nextDirtyBlock(0),
+      _lazyHighlighting(false),
+      _lazyCursor(0),
+      _lazyBlockCount(0),
+      _lazyFillBlockNumber(-1),
+      _firstVisibleBlockNumber(0),
+      _lastVisibleBlockNumber(0) {
     // _highlightingOptions = highlightingOptions;
-    _timer = new QTimer(this);
-    connect(_timer, &QTimer::timeout, this, &MarkdownHighlighter::timerTick);
-
-    _timer->start(1000);
 
-    // initialize the highlighting rules
-    initHighlightingRules();
-
-    // initialize the text formats
-    initTextFormats();
+    initStaticData();
+}
 
-    // initialize code langs
-    initCodeLangs();
+/**
+ * @brief Sets up the shared highlighting rules, text formats and code
+ * languages, only the first call in any thread does it
+ */
+void MarkdownHighlighter::initStaticData() {
+    // the initialization of a function local static is thread-safe
+    static const bool initialized = [] {
+        initHighlightingRules();
+        initTextFormats();
+        initCodeLangs();
+        return true;
+    }();
+    Q_UNUSED(initialized)
 }
 
 /**
- * Does jobs every second
+ * Re-highlights the dirty blocks in time slices and emits
+ * highlightingFinished() once all of them are done
  */
 void MarkdownHighlighter::timerTick() {
-    // re-highlight all dirty blocks
+    // nothing was scheduled yet
+    if (_timer == nullptr) {
+        return;
+    }
+
+    // the highlighter was detached from its document
+    if (!document()) {
+        clearDirtyBlockQueue();
+        return;
+    }
+
+    // re-highlight dirty blocks until the time budget is used up
     reHighlightDirtyBlocks();
 
-    // emit a signal every second if there was some highlighting done
+    // continue the cascades that were cut off at the visible range
+    highlightDeferredCascades();
+
+    // fill in the blocks that were skipped in lazy mode
+    if (_lazyHighlighting) {
+        highlightPendingBlocks();
+    }
+
+    emitOutlineChanged();
+    emitDegradationChanged();
+
+    // continue with the rest in the next event loop iteration
+    if (_dirtyBlockCount > 0 ||
+        (_lazyHighlighting && _lazyCursor < document()->blockCount())) {
+        scheduleTimerTick();
+        return;
+    }
+
+    // wait until the deferred cascades have settled
+    if (!_deferredCascades.isEmpty()) {
+        _timer->start(_cascadeTimer.isValid()
+                          ? qMax(0, cascadeSettleTime -
+                                        int(_cascadeTimer.elapsed()))
+                          : 0);
+        return;
+    }
+
+    // highlighting dirty blocks may have re-armed the timer
+    _timer->stop();
+
+    // emit a signal once per batch if there was some highlighting done
     if (_highlightingFinished) {
         _highlightingFinished = false;
         emit highlightingFinished();
+
+#ifdef MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+        _stats.lastBatchHighlightedBlocks = _batchHighlightedBlocks;
+        _batchHighlightedBlocks = 0;
+        emit statsUpdated();
+#endif
+    }
+}
+
+/**
+ * Arms the timer so that timerTick() runs in the next event loop iteration
+ */
+void MarkdownHighlighter::scheduleTimerTick() {
+    // the timer is only created when there is work to do, so idle editors
+    // don't wake up
+    if (_timer == nullptr) {
+        _timer = new QTimer(this);
+        _timer->setSingleShot(true);
+        connect(_timer, &QTimer::timeout, this,
+                &MarkdownHighlighter::timerTick);
+    }
+
+    // the timer may be waiting for deferred cascades to settle
+    if (!_timer->isActive() || _timer->remainingTime() > 0) {
+        _timer->start(0);
     }
 }
 
 /**
- * Re-highlights all dirty blocks
+ * Sets the time in milliseconds one timer tick may spend re-highlighting
+ * dirty blocks, 0 means no limit
+ *
+ * @param msecs
+ */
+void MarkdownHighlighter::setRehighlightTimeBudget(int msecs) {
+    _rehighlightTimeBudget = qMax(0, msecs);
+}
+
+/**
+ * Re-highlights dirty blocks until they are all done or the time budget
+ * is used up
  */
 void MarkdownHighlighter::reHighlightDirtyBlocks() {
-    while (_dirtyTextBlocks.count() > 0) {
-        QTextBlock block = _dirtyTextBlocks.at(0);
+    QElapsedTimer elapsedTimer;
+    elapsedTimer.start();
+
+    while (_nextDirtyBlock < _dirtyBlocks.size()) {
+        const QTextBlock block = _dirtyBlocks.at(_nextDirtyBlock++);
+        --_dirtyBlockCount;
+
+        // a block that was removed in the meantime has lost its data, a
+        // block that reuses its slot isn't marked
+        auto *data = block.isValid()
+                         ? dynamic_cast<MarkdownBlockData *>(block.userData())
+                         : nullptr;
+        if (data == nullptr || data->dirtyGeneration != _dirtyGeneration) {
+            continue;
+        }
+        data->dirtyGeneration = 0;
+
+        rehighlightBlock(block);
+
+        if (_rehighlightTimeBudget > 0 &&
+            elapsedTimer.elapsed() >= _rehighlightTimeBudget) {
+            break;
+        }
+    }
+
+    if (_nextDirtyBlock >= _dirtyBlocks.size()) {
+        clearDirtyBlockQueue();
+    }
+}
+
+/**
+ * Enables or disables lazy highlighting
+ *
+ * In lazy mode only the blocks in and around the visible range are
+ * highlighted right away, the rest of the document is highlighted in
+ * document order in idle time. This keeps loading very large documents
+ * responsive.
+ *
+ * @param enabled
+ */
+void MarkdownHighlighter::setLazyHighlighting(bool enabled) {
+    if (_lazyHighlighting == enabled) {
+        return;
+    }
+
+    _lazyHighlighting = enabled;
+
+    if (enabled) {
+        _lazyBlockCount = document() ? document()->blockCount() : 0;
+        _lazyCursor = _lazyBlockCount;
+    } else if (document() && _lazyCursor < document()->blockCount()) {
+        // some blocks may still be pending
+        rehighlight();
+    }
+}
+
+/**
+ * Returns true if blocks are still waiting to be highlighted in lazy mode
+ */
+bool MarkdownHighlighter::hasPendingBlocks() const {
+    return _lazyHighlighting && document() &&
+           _lazyCursor < document()->blockCount();
+}
+
+/**
+ * Tells the highlighter which blocks are currently visible, pending
+ * blocks in and around that range get highlighted right away in lazy mode
+ *
+ * @param firstBlockNumber
+ * @param lastBlockNumber
+ */
+void MarkdownHighlighter::setVisibleBlockRange(int firstBlockNumber,
+                                               int lastBlockNumber) {
+    _firstVisibleBlockNumber = firstBlockNumber;
+    _lastVisibleBlockNumber = qMax(firstBlockNumber, lastBlockNumber);
+    _visibleBlockRangeKnown = true;
+
+    if (!document()) {
+        return;
+    }
+
+    // blocks that became visible must not wait for their cascade to settle
+    if (!_deferredCascades.isEmpty()) {
+        _cascadeTimer.invalidate();
+        scheduleTimerTick();
+    }
+
+    if (!_lazyHighlighting) {
+        return;
+    }
+
+    // highlighting the first pending block also highlights the following
+    // ones, because its state changes
+    QTextBlock block = document()->findBlockByNumber(
+        qMax(0, _firstVisibleBlockNumber - lazyHighlightingMargin));
+    const int lastBlockNumberInRange =
+        _lastVisibleBlockNumber + lazyHighlightingMargin;
+
+    while (block.isValid() && block.blockNumber() <= lastBlockNumberInRange) {
+        if (block.userState() == LazyHighlightingPending) {
+            rehighlightBlock(block);
+        }
+        block = block.next();
+    }
+}
+
+/**
+ * Returns true if the highlighting of a block should be deferred in
+ * lazy mode
+ *
+ * @param blockNumber
+ */
+bool MarkdownHighlighter::isBlockDeferred(int blockNumber) const {
+    return blockNumber != _lazyFillBlockNumber &&
+           (blockNumber < _firstVisibleBlockNumber - lazyHighlightingMargin ||
+            blockNumber > _lastVisibleBlockNumber + lazyHighlightingMargin);
+}
+
+/**
+ * Highlights pending blocks in document order until the time budget is
+ * used up
+ *
+ * Every block is highlighted with the final state of its previous block,
+ * so code fences and the frontmatter are carried over correctly.
+ * Highlighting a block only touches the next block to mark it as pending
+ * again, which keeps every step cheap.
+ */
+void MarkdownHighlighter::highlightPendingBlocks() {
+    QElapsedTimer elapsedTimer;
+    elapsedTimer.start();
+
+    QTextBlock block = document()->findBlockByNumber(_lazyCursor);
+
+    while (block.isValid()) {
+        if (block.userState() == LazyHighlightingPending) {
+            _lazyFillBlockNumber = block.blockNumber();
+            rehighlightBlock(block);
+            _lazyFillBlockNumber = -1;
+        }
+
+        block = block.next();
+
+        if (_rehighlightTimeBudget > 0 &&
+            elapsedTimer.elapsed() >= _rehighlightTimeBudget) {
+            break;
+        }
+    }
+
+    _lazyCursor =
+        block.isValid() ? block.blockNumber() : document()->blockCount();
+}
+
+/**
+ * Returns true if a block that QSyntaxHighlighter re-highlights only
+ * because the state of its previous block changed should be left for the
+ * background
+ *
+ * @param blockNumber
+ */
+bool MarkdownHighlighter::isCascadeDeferred(int blockNumber) const {
+    return _visibleBlockRangeKnown && !_lazyHighlighting &&
+           blockNumber != _cascadeFillBlockNumber &&
+           (blockNumber <
+                _firstVisibleBlockNumber - cascadeHighlightingMargin ||
+            blockNumber > _lastVisibleBlockNumber + cascadeHighlightingMargin);
+}
+
+/**
+ * Keeps the formats and the state of the current block, which ends the
+ * cascade, and remembers where to continue it
+ */
+void MarkdownHighlighter::deferCascadeBlock() {
+    const QTextBlock block = currentBlock();
+
+    const auto formats = block.layout()->formats();
+    for (const auto &range : formats) {
+        setFormat(range.start, range.length, range.format);
+    }
+    setCurrentBlockState(block.userState());
+
+    const bool known = std::any_of(
+        _deferredCascades.cbegin(), _deferredCascades.cend(),
+        [&block](const QTextCursor &cursor) { return cursor.block() == block; });
+    if (!known) {
+        _deferredCascades.append(QTextCursor(block));
+    }
+
+    // an edit, not the background continuing a cascade
+    if (_cascadeFillBlockNumber < 0) {
+        _cascadeTimer.start();
+    }
+    scheduleTimerTick();
+}
+
+/**
+ * Continues the deferred cascades in document order until the time budget
+ * is used up, every step highlights a block and defers the next one again
+ */
+void MarkdownHighlighter::highlightDeferredCascades() {
+    if (_deferredCascades.isEmpty() ||
+        (_cascadeTimer.isValid() &&
+         _cascadeTimer.elapsed() < cascadeSettleTime)) {
+        return;
+    }
+
+    QElapsedTimer elapsedTimer;
+    elapsedTimer.start();
+
+    while (!_deferredCascades.isEmpty()) {
+        // the first one may catch up with the others
+        const auto first = std::min_element(
+            _deferredCascades.begin(), _deferredCascades.end(),
+            [](const QTextCursor &a, const QTextCursor &b) {
+                return a.position() < b.position();
+            });
+        const QTextBlock block = first->block();
+        _deferredCascades.erase(first);
+
+        _cascadeFillBlockNumber = block.blockNumber();
         rehighlightBlock(block);
-        _dirtyTextBlocks.removeFirst();
+        _cascadeFillBlockNumber = -1;
+
+        if (_rehighlightTimeBudget > 0 &&
+            elapsedTimer.elapsed() >= _rehighlightTimeBudget) {
+            break;
+        }
     }
 }
 
 /**
- * Clears the dirty blocks vector
+ * Clears the dirty blocks queue and restarts lazy highlighting at the top
+ * of the document
  */
 void MarkdownHighlighter::clearDirtyBlocks() {
-    _ranges.clear();
-    _dirtyTextBlocks.clear();
+    clearDirtyBlockQueue();
+    _deferredCascades.clear();
+    _lastHighlightedBlockNumber = -1;
+
+    _lazyCursor = 0;
+    _lazyBlockCount = 0;
+    _firstVisibleBlockNumber = 0;
+    _lastVisibleBlockNumber = 0;
+}
+
+/**
+ * Empties the dirty blocks queue
+ */
+void MarkdownHighlighter::clearDirtyBlockQueue() {
+    // the marks of the queued blocks become stale, so the blocks, which may
+    // belong to a document that is gone by now, aren't touched
+    ++_dirtyGeneration;
+    _dirtyBlocks.clear();
+    _dirtyBlockCount = 0;
+    _nextDirtyBlock = 0;
 }
 
 /**
- * Adds a dirty block to the list if it doesn't already exist
+ * Marks a block as dirty if it isn't already
+ *
+ * The mark lives in the user data of the block, so it stays with the block
+ * when blocks above it are inserted or removed.
  *
  * @param block
  */
-void MarkdownHighlighter::addDirtyBlock(const QTextBlock &block) {
-    if (!_dirtyTextBlocks.contains(block)) {
-        _dirtyTextBlocks.append(block);
+void MarkdownHighlighter::addDirtyBlock(QTextBlock block) {
+    if (!block.isValid()) {
+        return;
+    }
+
+    auto *data = dynamic_cast<MarkdownBlockData *>(block.userData());
+    if (data == nullptr) {
+        data = new MarkdownBlockData;
+        block.setUserData(data);
+    } else if (data->dirtyGeneration == _dirtyGeneration) {
+        return;
     }
+
+    data->dirtyGeneration = _dirtyGeneration;
+    _dirtyBlocks.append(block);
+    ++_dirtyBlockCount;
+#ifdef MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+    _stats.maxDirtyBlockCount =
+        qMax(_stats.maxDirtyBlockCount, _dirtyBlockCount);
+#endif
+    scheduleTimerTick();
 }
 
 /**
@@ -110,6 +511,9 @@ void MarkdownHighlighter::addDirtyBlock(const QTextBlock &block) {
  * /usr/share/kde4/apps/katepart/syntax/markdown.xml
  */
 void MarkdownHighlighter::initHighlightingRules() {
+    waitForConcurrentJobs();
+    _highlightingRules.clear();
+
     // highlight the reference of reference links
     {
         HighlightingRule rule(HighlighterState::MaskedSyntax);
@@ -119,15 +523,18 @@ void MarkdownHighlighter::initHighlightingRules() {
         _highlightingRules.append(rule);
     }
 
-    // highlight block quotes
+    // highlight block quotes, the rules are shared by all highlighters, so
+    // there is one for each setting of FullyHighlightedBlockQuote
     {
         HighlightingRule rule(HighlighterState::BlockQuote);
-        rule.pattern = QRegularExpression(
-            _highlightingOptions.testFlag(
-                HighlightingOption::FullyHighlightedBlockQuote)
-                ? QStringLiteral("^\\s*(>\\s*.+)")
-                : QStringLiteral("^\\s*(>\\s*)+"));
+        rule.pattern = QRegularExpression(QStringLiteral("^\\s*(>\\s*.+)"));
         rule.shouldContain = QStringLiteral("> ");
+        rule.options = HighlightingOption::FullyHighlightedBlockQuote;
+        _highlightingRules.append(rule);
+
+        rule.pattern = QRegularExpression(QStringLiteral("^\\s*(>\\s*)+"));
+        rule.options = HighlightingOption::None;
+        rule.excludedOptions = HighlightingOption::FullyHighlightedBlockQuote;
         _highlightingRules.append(rule);
     }
 
@@ -162,6 +569,7 @@ void MarkdownHighlighter::initHighlightingRules() {
             QStringLiteral("<([^\\s`][^`]*?\\.[^`]*?[^\\s`])>"));
         rule.capturingGroup = 1;
         rule.shouldContain = QStringLiteral("<");
+        rule.matchStartsWithShouldContain = true;
         _highlightingRules.append(rule);
 
         // highlight urls with title
@@ -170,23 +578,27 @@ void MarkdownHighlighter::initHighlightingRules() {
         rule.pattern = QRegularExpression(
             QStringLiteral(R"(\[([^\[\]]+)\]\((\S+|.+?)\)\B)"));
         rule.shouldContain = QStringLiteral("](");
+        rule.matchStartsWithShouldContain = false;
         _highlightingRules.append(rule);
 
         // highlight urls with empty title
         //    rule.pattern = QRegularExpression("\\[\\]\\((.+?://.+?)\\)");
         rule.pattern = QRegularExpression(QStringLiteral(R"(\[\]\((.+?)\))"));
         rule.shouldContain = QStringLiteral("[](");
+        rule.matchStartsWithShouldContain = true;
         _highlightingRules.append(rule);
 
         // highlight email links
         rule.pattern = QRegularExpression(QStringLiteral("<(.+?@.+?)>"));
         rule.shouldContain = QStringLiteral("@");
+        rule.matchStartsWithShouldContain = false;
         _highlightingRules.append(rule);
 
         // highlight reference links
         rule.pattern =
             QRegularExpression(QStringLiteral(R"(\[(.+?)\]\[.+?\])"));
         rule.shouldContain = QStringLiteral("[");
+        rule.matchStartsWithShouldContain = true;
         _highlightingRules.append(rule);
     }
 
@@ -198,6 +610,7 @@ void MarkdownHighlighter::initHighlightingRules() {
             QRegularExpression(QStringLiteral(R"(!\[(.+?)\]\(.+?\))"));
         rule.shouldContain = QStringLiteral("![");
         rule.capturingGroup = 1;
+        rule.matchStartsWithShouldContain = true;
         _highlightingRules.append(rule);
 
         // highlight images without text
@@ -213,6 +626,7 @@ void MarkdownHighlighter::initHighlightingRules() {
             QStringLiteral(R"(\[!\[(.+?)\]\(.+?\)\]\(.+?\))"));
         rule.shouldContain = QStringLiteral("[![");
         rule.capturingGroup = 1;
+        rule.matchStartsWithShouldContain = true;
         _highlightingRules.append(rule);
 
         // highlight images links without text
@@ -229,6 +643,7 @@ void MarkdownHighlighter::initHighlightingRules() {
         // waqar144: dont use QStringLiteral here.
         rule.shouldContain = QString(" \0");
         rule.capturingGroup = 1;
+        rule.matchStartsWithShouldContain = true;
         _highlightingRules.append(rule);
     }
 
@@ -246,6 +661,7 @@ void MarkdownHighlighter::initHighlightingRules() {
     {
         HighlightingRule rule(HighlighterState::Table);
         rule.shouldContain = QStringLiteral("|");
+        rule.matchStartsWithShouldContain = true;
         rule.pattern = QRegularExpression(QStringLiteral("^\\|.+?\\|$"));
         _highlightingRules.append(rule);
     }
@@ -257,6 +673,7 @@ void MarkdownHighlighter::initHighlightingRules() {
  * @param defaultFontSize
  */
 void MarkdownHighlighter::initTextFormats(int defaultFontSize) {
+    waitForConcurrentJobs();
     QTextCharFormat format;
 
     // set character formats for headlines
@@ -348,137 +765,1312 @@ void MarkdownHighlighter::initTextFormats(int defaultFontSize) {
     format.setForeground(Qt::darkRed);
     _formats[BlockQuote] = std::move(format);
 
-    format = QTextCharFormat();
-    _formats[HeadlineEnd] = std::move(format);
+    format = QTextCharFormat();
+    _formats[HeadlineEnd] = std::move(format);
+
+    format = QTextCharFormat();
+    _formats[NoState] = std::move(format);
+
+    /****************************************
+     * Formats for syntax highlighting
+     ***************************************/
+
+    format = QTextCharFormat();
+    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    format.setForeground(QColor(249, 38, 114));
+    _formats[CodeKeyWord] = std::move(format);
+
+    format = QTextCharFormat();
+    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    format.setForeground(QColor(163, 155, 78));
+    _formats[CodeString] = std::move(format);
+
+    format = QTextCharFormat();
+    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    format.setForeground(QColor(117, 113, 94));
+    _formats[CodeComment] = std::move(format);
+
+    format = QTextCharFormat();
+    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    format.setForeground(QColor(84, 174, 191));
+    _formats[CodeType] = std::move(format);
+
+    format = QTextCharFormat();
+    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    format.setForeground(QColor(219, 135, 68));
+    _formats[CodeOther] = std::move(format);
+
+    format = QTextCharFormat();
+    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    format.setForeground(QColor(174, 129, 255));
+    _formats[CodeNumLiteral] = std::move(format);
+
+    format = QTextCharFormat();
+    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    format.setForeground(QColor(1, 138, 15));
+    _formats[CodeBuiltIn] = std::move(format);
+
+    updateFormatTable();
+}
+
+/**
+ * @brief Maps a state to its slot in the table, -1 for states that can't
+ * have a format
+ */
+int MarkdownHighlighter::FormatTable::formatIndex(int state) {
+    if (state >= NoState && state <= LazyHighlightingPending) {
+        return state - NoState;
+    }
+
+    int index = LazyHighlightingPending - NoState + 1;
+    if (state >= CodeCpp && state < CodeCpp + 100) {
+        return index + state - CodeCpp;
+    }
+
+    index += 100;
+    if (state >= CodeCpp + tildeOffset && state < CodeCpp + tildeOffset + 100) {
+        return index + state - CodeCpp - tildeOffset;
+    }
+
+    index += 100;
+    if (state >= CodeKeyWord && state <= CodeBuiltIn) {
+        return index + state - CodeKeyWord;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Copies the formats into the table and derives the masked formats
+ */
+void MarkdownHighlighter::FormatTable::rebuild(
+    const QHash<HighlighterState, QTextCharFormat> &formats) {
+    _formats.fill(QTextCharFormat());
+    for (auto it = formats.constBegin(); it != formats.constEnd(); ++it) {
+        const int index = formatIndex(it.key());
+        if (index >= 0) {
+            _formats[index] = it.value();
+        }
+    }
+
+    const QTextCharFormat &maskedFormat =
+        _formats.at(formatIndex(MaskedSyntax));
+    for (int i = 0; i < formatTableSize; ++i) {
+        const qreal fontPointSize = _formats.at(i).fontPointSize();
+        if (fontPointSize > 0) {
+            QTextCharFormat format = maskedFormat;
+            format.setFontPointSize(fontPointSize);
+            _maskedFormats[i] = format;
+        } else {
+            _maskedFormats[i] = maskedFormat;
+        }
+    }
+}
+
+/**
+ * @brief Has to be called whenever _formats changes
+ */
+void MarkdownHighlighter::updateFormatTable() {
+    _formatTable.rebuild(_formats);
+    ++_formatsGeneration;
+}
+
+/**
+ * @brief initializes the langStringToEnum
+ */
+void MarkdownHighlighter::initCodeLangs() {
+    waitForConcurrentJobs();
+    MarkdownHighlighter::_langStringToEnum =
+        QHash<QString, MarkdownHighlighter::HighlighterState>{
+            {QLatin1String("bash"), MarkdownHighlighter::CodeBash},
+            {QLatin1String("c"), MarkdownHighlighter::CodeC},
+            {QLatin1String("cpp"), MarkdownHighlighter::CodeCpp},
+            {QLatin1String("cxx"), MarkdownHighlighter::CodeCpp},
+            {QLatin1String("c++"), MarkdownHighlighter::CodeCpp},
+            {QLatin1String("c#"), MarkdownHighlighter::CodeCSharp},
+            {QLatin1String("cmake"), MarkdownHighlighter::CodeCMake},
+            {QLatin1String("csharp"), MarkdownHighlighter::CodeCSharp},
+            {QLatin1String("css"), MarkdownHighlighter::CodeCSS},
+            {QLatin1String("go"), MarkdownHighlighter::CodeGo},
+            {QLatin1String("html"), MarkdownHighlighter::CodeXML},
+            {QLatin1String("ini"), MarkdownHighlighter::CodeINI},
+            {QLatin1String("java"), MarkdownHighlighter::CodeJava},
+            {QLatin1String("javascript"), MarkdownHighlighter::CodeJava},
+            {QLatin1String("js"), MarkdownHighlighter::CodeJs},
+            {QLatin1String("json"), MarkdownHighlighter::CodeJSON},
+            {QLatin1String("make"), MarkdownHighlighter::CodeMake},
+            {QLatin1String("php"), MarkdownHighlighter::CodePHP},
+            {QLatin1String("py"), MarkdownHighlighter::CodePython},
+            {QLatin1String("python"), MarkdownHighlighter::CodePython},
+            {QLatin1String("qml"), MarkdownHighlighter::CodeQML},
+            {QLatin1String("rust"), MarkdownHighlighter::CodeRust},
+            {QLatin1String("sh"), MarkdownHighlighter::CodeBash},
+            {QLatin1String("sql"), MarkdownHighlighter::CodeSQL},
+            {QLatin1String("taggerscript"),
+             MarkdownHighlighter::CodeTaggerScript},
+            {QLatin1String("ts"), MarkdownHighlighter::CodeTypeScript},
+            {QLatin1String("typescript"), MarkdownHighlighter::CodeTypeScript},
+            {QLatin1String("v"), MarkdownHighlighter::CodeV},
+            {QLatin1String("vex"), MarkdownHighlighter::CodeVex},
+            {QLatin1String("xml"), MarkdownHighlighter::CodeXML},
+            {QLatin1String("yml"), MarkdownHighlighter::CodeYAML},
+            {QLatin1String("yaml"), MarkdownHighlighter::CodeYAML}};
+}
+
+/**
+ * Sets the text formats
+ *
+ * @param formats
+ */
+void MarkdownHighlighter::setTextFormats(
+    QHash<HighlighterState, QTextCharFormat> formats) {
+    // the default formats must not overwrite these later
+    initStaticData();
+    waitForConcurrentJobs();
+    _formats = std::move(formats);
+    updateFormatTable();
+}
+
+/**
+ * Sets a text format
+ *
+ * @param formats
+ */
+void MarkdownHighlighter::setTextFormat(HighlighterState state,
+                                        QTextCharFormat format) {
+    initStaticData();
+    waitForConcurrentJobs();
+    _formats[state] = std::move(format);
+    updateFormatTable();
+}
+
+/**
+ * @brief Waits for the rehighlightConcurrently() jobs of all highlighters,
+ * the workers read the static rules and formats without a lock
+ *
+ * Canceled jobs only finish the blocks that are already being tokenized.
+ */
+void MarkdownHighlighter::waitForConcurrentJobs() {
+    for (QFuture<void> &job : _concurrentJobs) {
+        job.waitForFinished();
+    }
+    _concurrentJobs.clear();
+}
+
+/**
+ * @brief Returns a hash of the text formats, results computed with other
+ * formats must not be replayed
+ */
+QByteArray MarkdownHighlighter::formatsFingerprint() {
+    static int generation = -1;
+    static QByteArray fingerprint;
+
+    if (generation != _formatsGeneration) {
+        QList<HighlighterState> states = _formats.keys();
+        std::sort(states.begin(), states.end());
+
+        QByteArray data;
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out.setVersion(QDataStream::Qt_5_6);
+        for (const HighlighterState state : states) {
+            out << static_cast<qint32>(state) << _formats.value(state);
+        }
+
+        fingerprint = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+        generation = _formatsGeneration;
+    }
+
+    return fingerprint;
+}
+
+/**
+ * @brief Sets a cache that results of the tokenizer are replayed from, so
+ * documents that were highlighted before are highlighted faster
+ *
+ * The cache isn't owned and must outlive the highlighter or be unset.
+ *
+ * @param cache nullptr to not use a cache
+ */
+void MarkdownHighlighter::setHighlightCache(MarkdownHighlightCache *cache) {
+    _highlightCache = cache;
+}
+
+/**
+ * @brief Returns the last stage of Degradation whose limit a size exceeds
+ */
+static MarkdownHighlighter::Degradation degradationStage(
+    int size, int noAdditionalRulesLimit, int noInlineRulesLimit,
+    int noSyntaxLimit) {
+    auto exceeds = [size](int limit) { return limit > 0 && size > limit; };
+
+    if (exceeds(noSyntaxLimit)) {
+        return MarkdownHighlighter::Degradation::NoSyntax;
+    }
+    if (exceeds(noInlineRulesLimit)) {
+        return MarkdownHighlighter::Degradation::NoInlineRules;
+    }
+    if (exceeds(noAdditionalRulesLimit)) {
+        return MarkdownHighlighter::Degradation::NoAdditionalRules;
+    }
+    return MarkdownHighlighter::Degradation::None;
+}
+
+/**
+ * Does the markdown highlighting
+ *
+ * @param text
+ */
+void MarkdownHighlighter::highlightBlock(const QString &text) {
+    const QTextBlock block = currentBlock();
+    const int blockNumber = block.blockNumber();
+    const int stateBefore = block.userState();
+    const CodeBlockKind codeBlockKindBefore = codeBlockKind(block);
+
+    // QSyntaxHighlighter goes on with the next block as long as the state
+    // changes, e.g. for the rest of the document after a code fence was
+    // opened, only blocks that weren't edited themselves can be deferred
+    const bool cascade = _lastHighlightedStateChanged &&
+                         blockNumber == _lastHighlightedBlockNumber + 1 &&
+                         block.revision() != document()->revision();
+
+    // only the cascades of edits, which QSyntaxHighlighter re-highlights
+    // while the document emits contentsChange(), and their continuation in
+    // the background are deferred, rehighlight() and setDocument() still
+    // highlight every block
+    const bool editCascade =
+        cascade && (sender() == document() || _cascadeFillBlockNumber >= 0);
+
+    if (editCascade && isCascadeDeferred(blockNumber)) {
+        deferCascadeBlock();
+    } else {
+        highlightCurrentBlock(text);
+    }
+
+    _lastHighlightedBlockNumber = blockNumber;
+    _lastHighlightedStateChanged = currentBlockState() != stateBefore;
+
+    if (currentBlockState() != LazyHighlightingPending) {
+        updateHeading();
+    }
+
+    updateCodeFence(text);
+
+    if (codeBlockKind(currentBlock()) != codeBlockKindBefore) {
+        emit codeBlocksChanged();
+    }
+}
+
+/**
+ * @brief Tells how a block takes part in a code block by its state
+ */
+MarkdownHighlighter::CodeBlockKind MarkdownHighlighter::codeBlockKind(
+    const QTextBlock &block) {
+    const int state = block.userState();
+
+    if (isCodeBlockEnd(state)) {
+        return CodeBlockKind::End;
+    }
+
+    if (!isCodeBlock(state)) {
+        return CodeBlockKind::None;
+    }
+
+    // highlightBlock() remembers the fences, so the text isn't needed
+    const auto *data = dynamic_cast<MarkdownBlockData *>(block.userData());
+    return data != nullptr && data->codeFence ? CodeBlockKind::Fence
+                                              : CodeBlockKind::Content;
+}
+
+/**
+ * @brief Remembers if the current block is the opening line of a code
+ * block for codeBlockKind()
+ *
+ * @param text
+ */
+void MarkdownHighlighter::updateCodeFence(const QString &text) {
+    const bool codeFence = isCodeBlock(currentBlockState()) &&
+                           (text.startsWith(QLatin1String("```")) ||
+                            text.startsWith(QLatin1String("~~~")));
+
+    auto *data = dynamic_cast<MarkdownBlockData *>(currentBlockUserData());
+    if (data != nullptr) {
+        data->codeFence = codeFence;
+    } else if (codeFence) {
+        data = new MarkdownBlockData;
+        data->codeFence = true;
+        setCurrentBlockUserData(data);
+    }
+}
+
+/**
+ * Highlights the current block, or defers it when highlighting lazily
+ *
+ * @param text
+ */
+void MarkdownHighlighter::highlightCurrentBlock(const QString &text) {
+    if (_lazyHighlighting) {
+        const int blockNumber = currentBlock().blockNumber();
+
+        // blocks after an edit that added or removed blocks were moved,
+        // move the cursor with them
+        const int blockCount = document()->blockCount();
+        if (blockCount != _lazyBlockCount) {
+            if (blockNumber < _lazyCursor) {
+                _lazyCursor = qMax(blockNumber + 1,
+                                   _lazyCursor + blockCount - _lazyBlockCount);
+            }
+            _lazyBlockCount = blockCount;
+        }
+
+        if (isBlockDeferred(blockNumber)) {
+            setCurrentBlockState(LazyHighlightingPending);
+            _lazyCursor = qMin(_lazyCursor, blockNumber);
+            scheduleTimerTick();
+            return;
+        }
+    }
+
+    if (currentBlockState() == HeadlineEnd) {
+        currentBlock().previous().setUserState(NoState);
+        addDirtyBlock(currentBlock().previous());
+    }
+    setCurrentBlockState(HighlighterState::NoState);
+    currentBlock().setUserState(HighlighterState::NoState);
+
+    highlightMarkdown(text);
+
+    if (!_highlightingFinished) {
+        _highlightingFinished = true;
+        scheduleTimerTick();
+    }
+}
+
+/**
+ * Highlights the current block with the tokenizer
+ *
+ * @param text
+ */
+void MarkdownHighlighter::highlightMarkdown(const QString &text) {
+    const QTextBlock block = currentBlock();
+
+    // use the result of rehighlightConcurrently() if it was computed with
+    // the right state of the previous block
+    const int blockNumber = block.blockNumber();
+    if (blockNumber < _precomputedBlocks.size()) {
+        const PrecomputedBlock &precomputed =
+            _precomputedBlocks.at(blockNumber);
+        if (precomputed.input.previousState == previousBlockState() &&
+            precomputed.input.text == text) {
+            if (_highlightCache != nullptr &&
+                precomputed.result.degradation ==
+                    precomputed.input.degradation) {
+                _highlightCache->insert(MarkdownHighlightCache::key(
+                                            precomputed.input,
+                                            _highlightingOptions),
+                                        precomputed.result);
+            }
+            applyBlockResult(precomputed.result);
+            return;
+        }
+    }
+
+    const DegradationPolicy &policy = _degradationPolicy;
+    _documentDegradation = degradationStage(
+        document()->characterCount(), policy.noAdditionalRulesDocumentSize,
+        policy.noInlineRulesDocumentSize, policy.noSyntaxDocumentSize);
+
+    BlockInput input = blockInput(block);
+    input.previousState = previousBlockState();
+
+    if (_highlightCache == nullptr) {
+        applyBlockResult(tokenizeBlock(input, _highlightingOptions));
+        return;
+    }
+
+    const quint64 key =
+        MarkdownHighlightCache::key(input, _highlightingOptions);
+    const BlockResult *cached = _highlightCache->find(key);
+    if (cached != nullptr) {
+        applyBlockResult(*cached);
+        return;
+    }
+
+    // results that ran out of time may be complete the next time
+    const BlockResult result = tokenizeBlock(input, _highlightingOptions);
+    if (result.degradation == input.degradation) {
+        _highlightCache->insert(key, result);
+    }
+    applyBlockResult(result);
+}
+
+/**
+ * Returns the tokenizer input of a block, with the stage it has to be
+ * highlighted in by the degradation policy
+ */
+MarkdownHighlighter::BlockInput MarkdownHighlighter::blockInput(
+    const QTextBlock &block) const {
+    const DegradationPolicy &policy = _degradationPolicy;
+
+    BlockInput input;
+    input.text = block.text();
+    input.previousText = block.previous().text();
+    input.nextText = block.next().text();
+    input.previousState = block.previous().userState();
+    input.blockNumber = block.blockNumber();
+    input.degradation = qMax(
+        _documentDegradation,
+        degradationStage(input.text.length(),
+                         policy.noAdditionalRulesBlockLength,
+                         policy.noInlineRulesBlockLength,
+                         policy.noSyntaxBlockLength));
+    input.timeBudget = policy.blockTimeBudget;
+    return input;
+}
+
+/**
+ * Applies the result of the tokenizer to the current block
+ *
+ * @param result
+ */
+void MarkdownHighlighter::applyBlockResult(const BlockResult &result) {
+    for (const FormatRange &range : result.formats) {
+        setFormat(range.start, range.length, range.format);
+    }
+
+    setCurrentBlockState(result.state);
+
+#ifdef MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+    for (int i = 0; i < Stats::PhaseCount; ++i) {
+        _stats.phaseNsecs[i] += result.phaseNsecs[i];
+    }
+    if (result.syntaxState != NoState) {
+        _stats.syntaxNsecsByState[result.syntaxState] +=
+            result.phaseNsecs[Stats::Syntax];
+    }
+    ++_stats.highlightedBlocks;
+    ++_batchHighlightedBlocks;
+#endif
+
+    // the inline ranges live in the block, so they move with it
+    auto *data = dynamic_cast<MarkdownBlockData *>(currentBlockUserData());
+    if (data != nullptr) {
+        data->ranges = result.ranges;
+        updateReferenceDefinition(data, result);
+        updateBlockDegradation(data, result.degradation);
+    } else if (!result.ranges.isEmpty() || !result.referenceId.isEmpty() ||
+               result.degradation != Degradation::None) {
+        data = new MarkdownBlockData;
+        data->ranges = result.ranges;
+        updateReferenceDefinition(data, result);
+        updateBlockDegradation(data, result.degradation);
+        setCurrentBlockUserData(data);
+    }
+
+    if (result.previousStateChanged) {
+        // we want to re-highlight the previous block
+        // this must not done directly, but with a queue, otherwise it
+        // will crash
+        QTextBlock previousBlock = currentBlock().previous();
+        addDirtyBlock(previousBlock);
+        previousBlock.setUserState(result.previousState);
+    }
+}
+
+/**
+ * Keeps the reference definition index in sync with the definition of the
+ * block of data
+ */
+void MarkdownHighlighter::updateReferenceDefinition(MarkdownBlockData *data,
+                                                    const BlockResult &result) {
+    if (data->referenceId == result.referenceId &&
+        data->referenceUrl == result.referenceUrl) {
+        return;
+    }
+
+    removeReferenceDefinition(data);
+    data->referenceId = result.referenceId;
+    data->referenceUrl = result.referenceUrl;
+
+    if (!data->referenceId.isEmpty()) {
+        data->highlighter = this;
+        _referenceDefinitions.insert(data->referenceId, data);
+    }
+}
+
+void MarkdownHighlighter::removeReferenceDefinition(MarkdownBlockData *data) {
+    if (!data->referenceId.isEmpty()) {
+        _referenceDefinitions.remove(data->referenceId, data);
+    }
+}
+
+MarkdownBlockData::~MarkdownBlockData() {
+    // the block is gone, so are its reference definition, heading and stage
+    if (highlighter) {
+        highlighter->removeReferenceDefinition(this);
+        highlighter->removeHeading(this);
+        highlighter->updateBlockDegradation(
+            this, MarkdownHighlighter::Degradation::None);
+    }
+}
+
+/**
+ * Keeps the number of blocks in each stage of Degradation in sync with the
+ * stage of the block of data
+ */
+void MarkdownHighlighter::updateBlockDegradation(MarkdownBlockData *data,
+                                                 Degradation degradation) {
+    if (data->degradation == degradation) {
+        return;
+    }
+
+    if (data->degradation != Degradation::None) {
+        --_degradedBlockCounts[int(data->degradation) - 1];
+    }
+    if (degradation != Degradation::None) {
+        ++_degradedBlockCounts[int(degradation) - 1];
+        data->highlighter = this;
+    }
+    data->degradation = degradation;
+
+    // this is also called while the block gets deleted
+    scheduleTimerTick();
+}
+
+/**
+ * Emits degradationChanged() if the stage of the most degraded block
+ * changed
+ */
+void MarkdownHighlighter::emitDegradationChanged() {
+    Degradation degradation = _documentDegradation;
+    for (int i = 2; i >= 0; --i) {
+        if (_degradedBlockCounts[i] > 0) {
+            degradation = qMax(degradation, Degradation(i + 1));
+            break;
+        }
+    }
+
+    if (degradation != _degradation) {
+        _degradation = degradation;
+        emit degradationChanged(degradation);
+    }
+}
+
+/**
+ * @brief Sets when blocks are highlighted with fewer passes, e.g. very long
+ * lines of minified code or embedded images
+ *
+ * Blocks that are already highlighted keep their highlighting until they
+ * are highlighted again.
+ */
+void MarkdownHighlighter::setDegradationPolicy(
+    const DegradationPolicy &policy) {
+    _degradationPolicy = policy;
+}
+
+/**
+ * Keeps the outline in sync with the heading of the current block
+ */
+void MarkdownHighlighter::updateHeading() {
+    const int state = currentBlockState();
+    const int level = state >= H1 && state <= H6 ? state - H1 + 1 : 0;
+    auto *data = dynamic_cast<MarkdownBlockData *>(currentBlockUserData());
+
+    if (level == 0) {
+        if (data != nullptr) {
+            removeHeading(data);
+        }
+        return;
+    }
+
+    const QTextBlock block = currentBlock();
+    const QString title = headingTitle(block.text());
+    if (data == nullptr) {
+        data = new MarkdownBlockData;
+        setCurrentBlockUserData(data);
+    } else if (data->headingLevel == level && data->headingTitle == title) {
+        return;
+    }
+
+    const int index = outlineLowerBound(block.blockNumber());
+    if (data->headingLevel == 0) {
+        _outline.insert(index, data);
+    }
+
+    data->headingLevel = level;
+    data->headingTitle = title;
+    data->headingChanged = true;
+    data->block = block;
+    data->highlighter = this;
+
+    _outlineChangedFrom =
+        _outlineChangedFrom < 0 ? index : qMin(_outlineChangedFrom, index);
+    scheduleTimerTick();
+}
+
+/**
+ * @brief Returns the title of a heading block, without the markers of an
+ * atx heading
+ */
+QString MarkdownHighlighter::headingTitle(const QString &text) {
+    int i = 0;
+    while (i < text.length() && text.at(i) == QLatin1Char(' ')) {
+        ++i;
+    }
+
+    const int markerStart = i;
+    while (i < text.length() && text.at(i) == QLatin1Char('#') &&
+           i < markerStart + 6) {
+        ++i;
+    }
+
+    // a setext heading, the underline is the next block
+    if (i == markerStart || i >= text.length() ||
+        text.at(i) != QLatin1Char(' ')) {
+        return text.trimmed();
+    }
+
+    // the optional closing sequence of #
+    int end = text.length();
+    while (end > i && text.at(end - 1).isSpace()) {
+        --end;
+    }
+    int closingStart = end;
+    while (closingStart > i && text.at(closingStart - 1) == QLatin1Char('#')) {
+        --closingStart;
+    }
+    if (closingStart < end && text.at(closingStart - 1) == QLatin1Char(' ')) {
+        end = closingStart;
+    }
+
+    return text.mid(i, end - i).trimmed();
+}
+
+/**
+ * Returns the index of the first heading of the outline at or after a
+ * block
+ */
+int MarkdownHighlighter::outlineLowerBound(int blockNumber) const {
+    compactOutline();
+
+    const auto it = std::lower_bound(
+        _outline.constBegin(), _outline.constEnd(), blockNumber,
+        [](const MarkdownBlockData *data, int number) {
+            return data->block.blockNumber() < number;
+        });
+    return static_cast<int>(it - _outline.constBegin());
+}
+
+/**
+ * Removes the heading of a block from the outline
+ *
+ * It is only marked as removed, because this is also called while the
+ * block gets deleted and whole ranges of blocks are usually deleted in a
+ * row.
+ */
+void MarkdownHighlighter::removeHeading(MarkdownBlockData *data) {
+    if (data->headingLevel == 0) {
+        return;
+    }
+
+    data->headingLevel = 0;
+    data->headingTitle.clear();
+    data->headingChanged = false;
+
+    const int size = _outline.size();
+    int index = -1;
+    for (int i = 0; i < size && index < 0; ++i) {
+        const int candidate = (_outlineRemovalHint + i) % size;
+        if (_outline.at(candidate) == data) {
+            index = candidate;
+        }
+    }
+
+    if (index < 0) {
+        return;
+    }
+
+    _outline[index] = nullptr;
+    ++_outlineRemovedCount;
+    _outlineRemovalHint = index + 1;
+    _outlineChangedFrom =
+        _outlineChangedFrom < 0 ? index : qMin(_outlineChangedFrom, index);
+    scheduleTimerTick();
+}
+
+/**
+ * Drops the removed headings from the outline, the heading after a removed
+ * one is marked as changed, so that outlineChanged() covers the removal
+ */
+void MarkdownHighlighter::compactOutline() const {
+    if (_outlineRemovedCount == 0) {
+        return;
+    }
+
+    // headings can only have been removed from _outlineChangedFrom on
+    int to = _outlineChangedFrom;
+    bool removed = false;
+    for (int i = _outlineChangedFrom; i < _outline.size(); ++i) {
+        MarkdownBlockData *data = _outline.at(i);
+        if (data == nullptr) {
+            removed = true;
+            continue;
+        }
+
+        if (removed) {
+            data->headingChanged = true;
+            removed = false;
+        }
+        _outline[to++] = data;
+    }
+
+    if (removed) {
+        _outlineTailRemoved = true;
+    }
+    _outline.resize(to);
+    _outlineRemovedCount = 0;
+}
+
+/**
+ * Emits outlineChanged() for the headings that changed since it was
+ * emitted last, once per event loop iteration
+ */
+void MarkdownHighlighter::emitOutlineChanged() {
+    if (_outlineChangedFrom < 0) {
+        return;
+    }
+
+    compactOutline();
+
+    const int size = _outline.size();
+    int first = -1;
+    int last = -1;
+    for (int i = _outlineChangedFrom; i < size; ++i) {
+        MarkdownBlockData *data = _outline.at(i);
+        if (data->headingChanged) {
+            data->headingChanged = false;
+            if (first < 0) {
+                first = i;
+            }
+            last = i;
+        }
+    }
+
+    if (_outlineTailRemoved) {
+        _outlineTailRemoved = false;
+        if (first < 0) {
+            first = size;
+        }
+        last = size - 1;
+    }
+
+    _outlineChangedFrom = -1;
+    _outlineRemovalHint = 0;
+
+    if (first >= 0) {
+        emit outlineChanged(first, last);
+    }
+}
+
+/**
+ * @brief Returns the headings of the document in document order
+ *
+ * The outline is kept up to date as the blocks get highlighted, so in lazy
+ * mode it only has the headings that were highlighted so far.
+ */
+QVector<MarkdownHighlighter::Heading> MarkdownHighlighter::outline() const {
+    compactOutline();
+
+    QVector<Heading> headings;
+    headings.reserve(_outline.size());
+    for (const MarkdownBlockData *data : _outline) {
+        headings.append({data->block, data->headingLevel, data->headingTitle});
+    }
+
+    return headings;
+}
+
+int MarkdownHighlighter::headingCount() const {
+    compactOutline();
+    return _outline.size();
+}
+
+MarkdownHighlighter::Heading MarkdownHighlighter::heading(int index) const {
+    compactOutline();
+    if (index < 0 || index >= _outline.size()) {
+        return Heading();
+    }
+
+    const MarkdownBlockData *data = _outline.at(index);
+    return {data->block, data->headingLevel, data->headingTitle};
+}
+
+/**
+ * @brief Returns the index of the heading whose section contains a
+ * position, e.g. for breadcrumbs
+ *
+ * @param position a position in the document
+ * @return the index of the last heading at or before the position, -1 if
+ * there is none
+ */
+int MarkdownHighlighter::headingIndexAt(int position) const {
+    compactOutline();
+
+    const auto it = std::upper_bound(
+        _outline.constBegin(), _outline.constEnd(), position,
+        [](int pos, const MarkdownBlockData *data) {
+            return pos < data->block.position();
+        });
+    return static_cast<int>(it - _outline.constBegin()) - 1;
+}
+
+/**
+ * @brief Returns the highlighting statistics
+ *
+ * They are only collected if the highlighter is built with
+ * MARKDOWNHIGHLIGHTER_INSTRUMENTATION, otherwise everything is 0.
+ */
+MarkdownHighlighter::Stats MarkdownHighlighter::stats() const {
+#ifdef MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+    Stats stats = _stats;
+    stats.dirtyBlockCount = _dirtyBlockCount;
+    return stats;
+#else
+    return Stats();
+#endif
+}
+
+void MarkdownHighlighter::resetStats() {
+#ifdef MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+    _stats = Stats();
+    _batchHighlightedBlocks = 0;
+#endif
+}
+
+/**
+ * @brief Returns the url of a [id]: url reference definition
+ *
+ * The definitions are indexed as their blocks get highlighted. If an id is
+ * defined more than once the first definition in the document wins.
+ *
+ * @param referenceId the id of the reference
+ * @return the url or an empty string if there is no definition
+ */
+QString MarkdownHighlighter::referenceUrl(const QString &referenceId) const {
+    const int count = _referenceDefinitions.count(referenceId);
+    if (count == 0) {
+        return QString();
+    }
+
+    if (count == 1 || !document()) {
+        return _referenceDefinitions.value(referenceId)->referenceUrl;
+    }
+
+    for (QTextBlock block = document()->firstBlock(); block.isValid();
+         block = block.next()) {
+        auto *data = dynamic_cast<MarkdownBlockData *>(block.userData());
+        if (data != nullptr && data->referenceId == referenceId) {
+            return data->referenceUrl;
+        }
+    }
+
+    return QString();
+}
+
+/**
+ * Re-highlights the whole document like rehighlight(), but tokenizes the
+ * blocks on all cores in the background first
+ *
+ * Every block is tokenized with the state its previous block had before,
+ * which doesn't change for theme or option changes. Blocks where that
+ * turns out to be wrong are tokenized again while the results are applied.
+ * A job that is still running when this is called again is canceled.
+ */
+void MarkdownHighlighter::rehighlightConcurrently() {
+    if (!document()) {
+        return;
+    }
+
+    QSharedPointer<ConcurrentRehighlight> job(new ConcurrentRehighlight);
+    job->document = document();
+    job->revision = document()->revision();
+    job->formatsGeneration = _formatsGeneration;
+    job->blocks.reserve(document()->blockCount());
+
+    for (QTextBlock block = document()->firstBlock(); block.isValid();
+         block = block.next()) {
+        PrecomputedBlock precomputed;
+        precomputed.input = blockInput(block);
+        job->blocks.append(precomputed);
+    }
+
+    if (_concurrentWatcher == nullptr) {
+        _concurrentWatcher = new QFutureWatcher<void>(this);
+        connect(_concurrentWatcher, &QFutureWatcher<void>::finished, this,
+                &MarkdownHighlighter::applyConcurrentRehighlight);
+    } else {
+        _concurrentWatcher->cancel();
+    }
+
+    _concurrentRehighlight = job;
+
+    // the functor holds a reference to the job, so the blocks outlive a
+    // canceled job or a deleted highlighter
+    const HighlightingOptions options = _highlightingOptions;
+    const QFuture<void> future =
+        QtConcurrent::map(job->blocks, [job, options](PrecomputedBlock &block) {
+            block.result = tokenizeBlock(block.input, options);
+        });
+
+    _concurrentJobs.erase(
+        std::remove_if(_concurrentJobs.begin(), _concurrentJobs.end(),
+                       [](const QFuture<void> &running) {
+                           return running.isFinished();
+                       }),
+        _concurrentJobs.end());
+    _concurrentJobs.append(future);
+    _concurrentWatcher->setFuture(future);
+}
+
+/**
+ * Applies the results of the rehighlightConcurrently() job that finished
+ *
+ * If the document was edited or replaced or the text formats changed in
+ * the meantime the results are dropped and the document is re-highlighted
+ * without them.
+ */
+void MarkdownHighlighter::applyConcurrentRehighlight() {
+    QSharedPointer<ConcurrentRehighlight> job = _concurrentRehighlight;
+    _concurrentRehighlight.reset();
+
+    if (!job || _concurrentWatcher->isCanceled() || !document()) {
+        return;
+    }
+
+    if (document() != job->document ||
+        document()->revision() != job->revision ||
+        _formatsGeneration != job->formatsGeneration ||
+        document()->blockCount() != job->blocks.size()) {
+        rehighlight();
+        return;
+    }
+
+    _precomputedBlocks.swap(job->blocks);
+    rehighlight();
+    _precomputedBlocks.clear();
+}
+
+/**
+ * Tokenizes a block of text
+ *
+ * This doesn't depend on a document or on QSyntaxHighlighter and only
+ * reads the static formats and rules, so it can be called from worker
+ * threads as long as the formats are not changed at the same time.
+ *
+ * @param input the text of the block and its surroundings
+ * @param options
+ * @return the formats, state and inline ranges of the block
+ */
+MarkdownHighlighter::BlockResult MarkdownHighlighter::tokenizeBlock(
+    const BlockInput &input, HighlightingOptions options) {
+    Tokenizer tokenizer(input, options);
+    return tokenizer.tokenize();
+}
+
+/**
+ * @brief Tokenizes a whole text without a document, e.g. for headless use
+ *
+ * The blocks are separated by newlines and tokenized one after the other,
+ * each with the state of the previous one. Safe to call from several
+ * threads as long as the formats are not changed at the same time.
+ *
+ * @param text the plain text
+ * @param options
+ * @return the result for every block of the text
+ */
+QVector<MarkdownHighlighter::BlockResult> MarkdownHighlighter::tokenizeText(
+    const QString &text, HighlightingOptions options) {
+    initStaticData();
+
+    const QStringList lines = text.split(QLatin1Char('\n'));
+    QVector<BlockResult> results;
+    results.reserve(lines.size());
+
+    BlockInput input;
+    for (int i = 0; i < lines.size(); ++i) {
+        input.text = lines.at(i);
+        input.previousText = i > 0 ? lines.at(i - 1) : QString();
+        input.nextText = i + 1 < lines.size() ? lines.at(i + 1) : QString();
+        input.previousState = i > 0 ? results.last().state : NoState;
+        input.blockNumber = i;
+
+        results.append(tokenizeBlock(input, options));
+
+        // setext headlines change the state of the previous block
+        if (i > 0 && results.last().previousStateChanged) {
+            results[i - 1].state = results.last().previousState;
+        }
+    }
+
+    return results;
+}
+
+static QString cssColor(const QColor &color) {
+    if (color.alpha() == 255) {
+        return color.name();
+    }
+
+    return QStringLiteral("rgba(%1,%2,%3,%4)")
+        .arg(color.red())
+        .arg(color.green())
+        .arg(color.blue())
+        .arg(color.alphaF());
+}
+
+static QString formatToCss(const QTextCharFormat &format) {
+    QStringList css;
+
+    if (format.foreground().style() != Qt::NoBrush) {
+        css << QStringLiteral("color:") + cssColor(format.foreground().color());
+    }
+    if (format.background().style() != Qt::NoBrush) {
+        css << QStringLiteral("background-color:") +
+                   cssColor(format.background().color());
+    }
+    if (format.fontWeight() >= QFont::DemiBold) {
+        css << QStringLiteral("font-weight:bold");
+    }
+    if (format.fontItalic()) {
+        css << QStringLiteral("font-style:italic");
+    }
+    if (format.fontUnderline() || format.fontStrikeOut()) {
+        css << QStringLiteral("text-decoration:") +
+                   (format.fontUnderline() ? QStringLiteral("underline ")
+                                           : QString()) +
+                   (format.fontStrikeOut() ? QStringLiteral("line-through")
+                                           : QString());
+    }
+    if (format.fontPointSize() > 0) {
+        css << QStringLiteral("font-size:%1pt").arg(format.fontPointSize());
+    }
+
+    return css.join(QLatin1Char(';'));
+}
+
+/**
+ * @brief Renders a highlighted text as HTML without a document
+ *
+ * @param text the plain text
+ * @param options
+ * @return a <pre> element with a styled <span> per format run
+ */
+QString MarkdownHighlighter::toHtml(const QString &text,
+                                    HighlightingOptions options) {
+    const QStringList lines = text.split(QLatin1Char('\n'));
+    const QVector<BlockResult> results = tokenizeText(text, options);
+    QString html = QStringLiteral("<pre>");
+
+    for (int i = 0; i < lines.size(); ++i) {
+        const QString &line = lines.at(i);
+        int position = 0;
+
+        for (const FormatRange &range : results.at(i).formats) {
+            html += line.mid(position, range.start - position).toHtmlEscaped();
+            html += QStringLiteral("<span style=\"") +
+                    formatToCss(range.format) + QStringLiteral("\">") +
+                    line.mid(range.start, range.length).toHtmlEscaped() +
+                    QStringLiteral("</span>");
+            position = range.start + range.length;
+        }
 
-    format = QTextCharFormat();
-    _formats[NoState] = std::move(format);
+        html += line.mid(position).toHtmlEscaped();
+        if (i + 1 < lines.size()) {
+            html += QLatin1Char('\n');
+        }
+    }
 
-    /****************************************
-     * Formats for syntax highlighting
-     ***************************************/
+    html += QStringLiteral("</pre>");
+    return html;
+}
 
-    format = QTextCharFormat();
-    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
-    format.setForeground(QColor(249, 38, 114));
-    _formats[CodeKeyWord] = std::move(format);
+MarkdownHighlighter::Tokenizer::Tokenizer(const BlockInput &input,
+                                          HighlightingOptions options)
+    : _input(input),
+      _highlightingOptions(options),
+      _formats(MarkdownHighlighter::_formatTable),
+      _previousState(input.previousState),
+      _state(NoState),
+      _previousStateChanged(false),
+      _degradation(input.degradation) {}
 
-    format = QTextCharFormat();
-    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
-    format.setForeground(QColor(163, 155, 78));
-    _formats[CodeString] = std::move(format);
+/**
+ * Runs the highlighting functions over the block and collects their result
+ */
+MarkdownHighlighter::BlockResult MarkdownHighlighter::Tokenizer::tokenize() {
+    _formatChanges.fill(QTextCharFormat(), _input.text.length());
+    if (_input.timeBudget > 0) {
+        _timer.start();
+    }
 
-    format = QTextCharFormat();
-    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
-    format.setForeground(QColor(117, 113, 94));
-    _formats[CodeComment] = std::move(format);
+    highlightMarkdown(_input.text);
+
+    BlockResult result;
+    result.state = _state;
+    result.referenceId = _referenceId;
+    result.referenceUrl = _referenceUrl;
+    result.degradation = _degradation;
+#ifdef MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+    std::copy(_phaseNsecs, _phaseNsecs + Stats::PhaseCount, result.phaseNsecs);
+    result.syntaxState = _syntaxState;
+#endif
+    result.ranges.codeSpans = _codeSpans;
+    result.ranges.emphasisByBegin = _emphasisRanges;
+    std::sort(result.ranges.emphasisByBegin.begin(),
+              result.ranges.emphasisByBegin.end(), rangeBeginLessThan);
+    result.ranges.emphasisByEnd = _emphasisRanges;
+    std::sort(result.ranges.emphasisByEnd.begin(),
+              result.ranges.emphasisByEnd.end(), rangeEndLessThan);
+    result.previousState = _previousState;
+    result.previousStateChanged = _previousStateChanged;
+
+    // merge equal neighboring formats into ranges, unformatted text is
+    // left out
+    const QTextCharFormat emptyFormat;
+    const int length = _formatChanges.size();
+    int start = 0;
+    while (start < length) {
+        const QTextCharFormat &format = _formatChanges.at(start);
+        int end = start + 1;
+        while (end < length && _formatChanges.at(end) == format) {
+            ++end;
+        }
 
-    format = QTextCharFormat();
-    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
-    format.setForeground(QColor(84, 174, 191));
-    _formats[CodeType] = std::move(format);
+        if (format != emptyFormat) {
+            result.formats.append({start, end - start, format});
+        }
+        start = end;
+    }
 
-    format = QTextCharFormat();
-    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
-    format.setForeground(QColor(219, 135, 68));
-    _formats[CodeOther] = std::move(format);
+    return result;
+}
 
-    format = QTextCharFormat();
-    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
-    format.setForeground(QColor(174, 129, 255));
-    _formats[CodeNumLiteral] = std::move(format);
+/**
+ * Returns true if the passes of a stage of Degradation are skipped, because
+ * of the input or because the time budget of the block is used up
+ */
+bool MarkdownHighlighter::Tokenizer::isSkipped(Degradation stage) {
+    if (_degradation >= stage) {
+        return true;
+    }
 
-    format = QTextCharFormat();
-    format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
-    format.setForeground(QColor(1, 138, 15));
-    _formats[CodeBuiltIn] = std::move(format);
+    if (_input.timeBudget > 0 && _timer.elapsed() >= _input.timeBudget) {
+        _degradation = stage;
+        return true;
+    }
+
+    return false;
 }
 
 /**
- * @brief initializes the langStringToEnum
+ * Same as QSyntaxHighlighter::setFormat, but on the tokenizer's own buffer
  */
-void MarkdownHighlighter::initCodeLangs() {
-    MarkdownHighlighter::_langStringToEnum =
-        QHash<QString, MarkdownHighlighter::HighlighterState>{
-            {QLatin1String("bash"), MarkdownHighlighter::CodeBash},
-            {QLatin1String("c"), MarkdownHighlighter::CodeC},
-            {QLatin1String("cpp"), MarkdownHighlighter::CodeCpp},
-            {QLatin1String("cxx"), MarkdownHighlighter::CodeCpp},
-            {QLatin1String("c++"), MarkdownHighlighter::CodeCpp},
-            {QLatin1String("c#"), MarkdownHighlighter::CodeCSharp},
-            {QLatin1String("cmake"), MarkdownHighlighter::CodeCMake},
-            {QLatin1String("csharp"), MarkdownHighlighter::CodeCSharp},
-            {QLatin1String("css"), MarkdownHighlighter::CodeCSS},
-            {QLatin1String("go"), MarkdownHighlighter::CodeGo},
-            {QLatin1String("html"), MarkdownHighlighter::CodeXML},
-            {QLatin1String("ini"), MarkdownHighlighter::CodeINI},
-            {QLatin1String("java"), MarkdownHighlighter::CodeJava},
-            {QLatin1String("javascript"), MarkdownHighlighter::CodeJava},
-            {QLatin1String("js"), MarkdownHighlighter::CodeJs},
-            {QLatin1String("json"), MarkdownHighlighter::CodeJSON},
-            {QLatin1String("make"), MarkdownHighlighter::CodeMake},
-            {QLatin1String("php"), MarkdownHighlighter::CodePHP},
-            {QLatin1String("py"), MarkdownHighlighter::CodePython},
-            {QLatin1String("python"), MarkdownHighlighter::CodePython},
-            {QLatin1String("qml"), MarkdownHighlighter::CodeQML},
-            {QLatin1String("rust"), MarkdownHighlighter::CodeRust},
-            {QLatin1String("sh"), MarkdownHighlighter::CodeBash},
-            {QLatin1String("sql"), MarkdownHighlighter::CodeSQL},
-            {QLatin1String("taggerscript"),
-             MarkdownHighlighter::CodeTaggerScript},
-            {QLatin1String("ts"), MarkdownHighlighter::CodeTypeScript},
-            {QLatin1String("typescript"), MarkdownHighlighter::CodeTypeScript},
-            {QLatin1String("v"), MarkdownHighlighter::CodeV},
-            {QLatin1String("vex"), MarkdownHighlighter::CodeVex},
-            {QLatin1String("xml"), MarkdownHighlighter::CodeXML},
-            {QLatin1String("yml"), MarkdownHighlighter::CodeYAML},
-            {QLatin1String("yaml"), MarkdownHighlighter::CodeYAML}};
+void MarkdownHighlighter::Tokenizer::setFormat(int start, int count,
+                                               const QTextCharFormat &format) {
+    if (start < 0 || start >= _formatChanges.size()) {
+        return;
+    }
+
+    const int end = qMin(start + count, _formatChanges.size());
+    for (int i = start; i < end; ++i) {
+        _formatChanges[i] = format;
+    }
+}
+
+QTextCharFormat MarkdownHighlighter::Tokenizer::format(int position) const {
+    return _formatChanges.value(position);
 }
 
 /**
- * Sets the text formats
+ * Makes [start, end) bold or italic on top of the formats that are already
+ * there, one run of equal formats at a time instead of character by
+ * character
  *
- * @param formats
+ * @param emphasis Bold or Italic
+ * @param underline underline instead of changing the font
  */
-void MarkdownHighlighter::setTextFormats(
-    QHash<HighlighterState, QTextCharFormat> formats) {
-    _formats = std::move(formats);
+void MarkdownHighlighter::Tokenizer::applyEmphasis(int start, int end,
+                                                   HighlighterState emphasis,
+                                                   bool underline) {
+    end = qMin(end, _formatChanges.size());
+
+    while (start < end) {
+        const QTextCharFormat base = _formatChanges.at(start);
+        int runEnd = start + 1;
+        while (runEnd < end && _formatChanges.at(runEnd) == base) {
+            ++runEnd;
+        }
+
+        setFormat(start, runEnd - start,
+                  emphasisFormat(base, emphasis, underline));
+        start = runEnd;
+    }
 }
 
 /**
- * Sets a text format
- *
- * @param formats
+ * Returns a format with emphasis on top of base, every combination is only
+ * built once per block so equal runs share their format data
  */
-void MarkdownHighlighter::setTextFormat(HighlighterState state,
-                                        QTextCharFormat format) {
-    _formats[state] = std::move(format);
+QTextCharFormat MarkdownHighlighter::Tokenizer::emphasisFormat(
+    const QTextCharFormat &base, HighlighterState emphasis, bool underline) {
+    for (const EmphasisFormat &cached : _emphasisFormats) {
+        if (cached.emphasis == emphasis && cached.underline == underline &&
+            cached.base == base) {
+            return cached.format;
+        }
+    }
+
+    QTextCharFormat format = base;
+    // if we are in plain text, use the format's specified color
+    if (format.foreground() == QTextCharFormat().foreground()) {
+        format.setForeground(_formats[emphasis].foreground());
+    }
+
+    if (underline) {
+        format.setFontUnderline(true);
+    } else if (emphasis == Bold) {
+        format.setFontWeight(QFont::Bold);
+    } else {
+        format.setFontItalic(true);
+    }
+
+    _emphasisFormats.append({base, emphasis, underline, format});
+    return format;
 }
 
 /**
- * Does the markdown highlighting
+ * Changes the state of the previous block, the highlighter will
+ * re-highlight it afterwards
  *
- * @param text
+ * @param state
  */
-void MarkdownHighlighter::highlightBlock(const QString &text) {
-    if (currentBlockState() == HeadlineEnd) {
-        currentBlock().previous().setUserState(NoState);
-        addDirtyBlock(currentBlock().previous());
-    }
-    setCurrentBlockState(HighlighterState::NoState);
-    currentBlock().setUserState(HighlighterState::NoState);
+void MarkdownHighlighter::Tokenizer::setPreviousBlockState(int state) {
+    _previousState = state;
+    _previousStateChanged = true;
+}
 
-    highlightMarkdown(text);
-    _highlightingFinished = true;
+bool MarkdownHighlighter::Tokenizer::isPosInACodeSpan(int position) const {
+    // the code spans are found from left to right, so they are sorted
+    return isPosInRanges(_codeSpans, position);
 }
 
-void MarkdownHighlighter::highlightMarkdown(const QString &text) {
+void MarkdownHighlighter::Tokenizer::highlightMarkdown(const QString &text) {
     const bool isBlockCodeBlock = isCodeBlock(previousBlockState()) ||
                                   text.startsWith(QLatin1String("```")) ||
                                   text.startsWith(QLatin1String("~~~"));
 
     if (!text.isEmpty() && !isBlockCodeBlock) {
-        highlightAdditionalRules(_highlightingRules, text);
+        if (!isSkipped(Degradation::NoAdditionalRules)) {
+            highlightAdditionalRules(_highlightingRules, text);
+        }
 
         highlightThematicBreak(text);
 
@@ -489,7 +2081,11 @@ void MarkdownHighlighter::highlightMarkdown(const QString &text) {
 
         highlightLists(text);
 
-        highlightInlineRules(text);
+        if (!isSkipped(Degradation::NoInlineRules)) {
+            highlightInlineRules(text);
+        }
+
+        parseReferenceDefinition(text);
     }
 
     highlightCommentBlock(text);
@@ -497,6 +2093,26 @@ void MarkdownHighlighter::highlightMarkdown(const QString &text) {
     highlightFrontmatterBlock(text);
 }
 
+/**
+ * Remembers a [id]: url reference definition, so reference links can be
+ * resolved without searching the document
+ *
+ * @param text
+ */
+void MarkdownHighlighter::Tokenizer::parseReferenceDefinition(
+    const QString &text) {
+    if (text.at(0) != QLatin1Char('[')) return;
+
+    static const QRegularExpression regex(
+        QStringLiteral(R"(^\[(.+?)\]: (\S+))"));
+    const QRegularExpressionMatch match = regex.match(text);
+
+    if (match.hasMatch()) {
+        _referenceId = match.captured(1);
+        _referenceUrl = match.captured(2);
+    }
+}
+
 /**
  * @brief gets indentation(spaces) of text
  * @param text
@@ -516,7 +2132,9 @@ int getIndentation(const QString &text) {
  *
  * @param text
  */
-void MarkdownHighlighter::highlightHeadline(const QString &text) {
+void MarkdownHighlighter::Tokenizer::highlightHeadline(const QString &text) {
+    MEASURE_PHASE(Stats::Headline);
+
     // three spaces indentation is allowed in headings
     const int spacesOffset = getIndentation(text);
 
@@ -556,7 +2174,7 @@ void MarkdownHighlighter::highlightHeadline(const QString &text) {
     };
 
     // take care of ==== and ---- headlines
-    const QString &prev = currentBlock().previous().text();
+    const QString &prev = _input.previousText;
     auto prevSpaces = getIndentation(prev);
 
     if (text.at(spacesOffset) == QLatin1Char('=') && prevSpaces < 4) {
@@ -575,7 +2193,7 @@ void MarkdownHighlighter::highlightHeadline(const QString &text) {
         }
     }
 
-    const QString &nextBlockText = currentBlock().next().text();
+    const QString &nextBlockText = _input.nextText;
     if (nextBlockText.isEmpty()) return;
     const int nextSpaces = getIndentation(nextBlockText);
 
@@ -599,32 +2217,22 @@ void MarkdownHighlighter::highlightHeadline(const QString &text) {
     }
 }
 
-void MarkdownHighlighter::highlightSubHeadline(const QString &text,
-                                               HighlighterState state) {
-    const QTextCharFormat &maskedFormat =
-        _formats[HighlighterState::MaskedSyntax];
-    QTextBlock previousBlock = currentBlock().previous();
-
+void MarkdownHighlighter::Tokenizer::highlightSubHeadline(
+    const QString &text, HighlighterState state) {
     // we check for both H1/H2 so that if the user changes his mind, and changes
     // === to ---, changes be reflected immediately
     if (previousBlockState() == H1 || previousBlockState() == H2 ||
         previousBlockState() == NoState) {
-        QTextCharFormat currentMaskedFormat = maskedFormat;
-        // set the font size from the current rule's font format
-        currentMaskedFormat.setFontPointSize(_formats[state].fontPointSize());
-
-        setFormat(0, text.length(), currentMaskedFormat);
+        // the masked format at the font size of the current rule's format
+        setFormat(0, text.length(), _formats.masked(state));
         setCurrentBlockState(HeadlineEnd);
 
-        // we want to re-highlight the previous block
-        // this must not done directly, but with a queue, otherwise it
-        // will crash
+        // the highlighter re-highlights the previous block with that state
         // setting the character format of the previous text, because this
         // causes text to be formatted the same way when writing after
         // the text
         if (previousBlockState() != state) {
-            addDirtyBlock(previousBlock);
-            previousBlock.setUserState(state);
+            setPreviousBlockState(state);
         }
     }
 }
@@ -634,12 +2242,13 @@ void MarkdownHighlighter::highlightSubHeadline(const QString &text,
  * and no list character after that
  * @param text
  */
-void MarkdownHighlighter::highlightIndentedCodeBlock(const QString &text) {
+void MarkdownHighlighter::Tokenizer::highlightIndentedCodeBlock(
+    const QString &text) {
     if (text.isEmpty() || (!text.startsWith(QLatin1String("    ")) &&
                            !text.startsWith(QLatin1Char('\t'))))
         return;
 
-    const QString prevTrimmed =  currentBlock().previous().text().trimmed();
+    const QString prevTrimmed = _input.previousText.trimmed();
     // previous line must be empty according to CommonMark except if it is a
     // heading https://spec.commonmark.org/0.29/#indented-code-block
     if (!prevTrimmed.isEmpty() &&
@@ -661,7 +2270,7 @@ void MarkdownHighlighter::highlightIndentedCodeBlock(const QString &text) {
     setFormat(0, text.length(), _formats[CodeBlock]);
 }
 
-void MarkdownHighlighter::highlightCodeFence(const QString &text) {
+void MarkdownHighlighter::Tokenizer::highlightCodeFence(const QString &text) {
     // already in tilde block
     if ((previousBlockState() == CodeBlockTilde ||
          previousBlockState() == CodeBlockTildeComment ||
@@ -683,8 +2292,8 @@ void MarkdownHighlighter::highlightCodeFence(const QString &text) {
  *
  * @param text
  */
-void MarkdownHighlighter::highlightCodeBlock(const QString &text,
-                                             const QString &opener) {
+void MarkdownHighlighter::Tokenizer::highlightCodeBlock(
+    const QString &text, const QString &opener) {
     if (text.startsWith(opener)) {
         // if someone decides to put these on the same line
         // interpret it as inline code, not code block
@@ -721,14 +2330,15 @@ void MarkdownHighlighter::highlightCodeBlock(const QString &text,
             setCurrentBlockState(state);
         }
 
-        // set the font size from the current rule's font format
-        QTextCharFormat &maskedFormat = _formats[MaskedSyntax];
-        maskedFormat.setFontPointSize(_formats[CodeBlock].fontPointSize());
-
-        setFormat(0, text.length(), maskedFormat);
+        // the masked format at the font size of the code block format
+        setFormat(0, text.length(), _formats.masked(CodeBlock));
     } else if (isCodeBlock(previousBlockState())) {
         setCurrentBlockState(previousBlockState());
-        highlightSyntax(text);
+        if (isSkipped(Degradation::NoSyntax)) {
+            setFormat(0, text.length(), _formats[CodeBlock]);
+        } else {
+            highlightSyntax(text);
+        }
     }
 }
 
@@ -736,9 +2346,16 @@ void MarkdownHighlighter::highlightCodeBlock(const QString &text,
  * @brief Does the code syntax highlighting
  * @param text
  */
-void MarkdownHighlighter::highlightSyntax(const QString &text) {
+void MarkdownHighlighter::Tokenizer::highlightSyntax(const QString &text) {
     if (text.isEmpty()) return;
 
+    MEASURE_PHASE(Stats::Syntax);
+#ifdef MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+    _syntaxState = currentBlockState() >= tildeOffset
+                       ? currentBlockState() - tildeOffset
+                       : currentBlockState();
+#endif
+
     const auto textLen = text.length();
 
     QChar comment;
@@ -746,90 +2363,87 @@ void MarkdownHighlighter::highlightSyntax(const QString &text) {
     bool isYAML = false;
     bool isMake = false;
 
-    QMultiHash<char, QLatin1String> keywords{};
-    QMultiHash<char, QLatin1String> others{};
-    QMultiHash<char, QLatin1String> types{};
-    QMultiHash<char, QLatin1String> builtin{};
-    QMultiHash<char, QLatin1String> literals{};
+    static constexpr LanguageData noLanguageData{};
+    const LanguageData *langData = &noLanguageData;
 
     switch (currentBlockState()) {
         case HighlighterState::CodeCpp:
         case HighlighterState::CodeCpp + tildeOffset:
         case HighlighterState::CodeCppComment:
         case HighlighterState::CodeCppComment + tildeOffset:
-            loadCppData(types, keywords, builtin, literals, others);
+            langData = &cppLanguageData();
             break;
         case HighlighterState::CodeJs:
         case HighlighterState::CodeJs + tildeOffset:
         case HighlighterState::CodeJsComment:
         case HighlighterState::CodeJsComment + tildeOffset:
-            loadJSData(types, keywords, builtin, literals, others);
+            langData = &jsLanguageData();
             break;
         case HighlighterState::CodeC:
         case HighlighterState::CodeC + tildeOffset:
         case HighlighterState::CodeCComment:
         case HighlighterState::CodeCComment + tildeOffset:
-            loadCppData(types, keywords, builtin, literals, others);
+            langData = &cppLanguageData();
             break;
         case HighlighterState::CodeBash:
         case HighlighterState::CodeBash + tildeOffset:
-            loadShellData(types, keywords, builtin, literals, others);
+            langData = &shellLanguageData();
             comment = QLatin1Char('#');
             break;
         case HighlighterState::CodePHP:
         case HighlighterState::CodePHP + tildeOffset:
         case HighlighterState::CodePHPComment:
         case HighlighterState::CodePHPComment + tildeOffset:
-            loadPHPData(types, keywords, builtin, literals, others);
+            langData = &phpLanguageData();
             break;
         case HighlighterState::CodeQML:
         case HighlighterState::CodeQML + tildeOffset:
         case HighlighterState::CodeQMLComment:
         case HighlighterState::CodeQMLComment + tildeOffset:
-            loadQMLData(types, keywords, builtin, literals, others);
+            langData = &qmlLanguageData();
             break;
         case HighlighterState::CodePython:
         case HighlighterState::CodePython + tildeOffset:
-            loadPythonData(types, keywords, builtin, literals, others);
+            langData = &pythonLanguageData();
             comment = QLatin1Char('#');
             break;
         case HighlighterState::CodeRust:
         case HighlighterState::CodeRust + tildeOffset:
         case HighlighterState::CodeRustComment:
         case HighlighterState::CodeRustComment + tildeOffset:
-            loadRustData(types, keywords, builtin, literals, others);
+            langData = &rustLanguageData();
             break;
         case HighlighterState::CodeJava:
         case HighlighterState::CodeJava + tildeOffset:
         case HighlighterState::CodeJavaComment:
         case HighlighterState::CodeJavaComment + tildeOffset:
-            loadJavaData(types, keywords, builtin, literals, others);
+            langData = &javaLanguageData();
             break;
         case HighlighterState::CodeCSharp:
         case HighlighterState::CodeCSharp + tildeOffset:
         case HighlighterState::CodeCSharpComment:
         case HighlighterState::CodeCSharpComment + tildeOffset:
-            loadCSharpData(types, keywords, builtin, literals, others);
+            langData = &csharpLanguageData();
             break;
         case HighlighterState::CodeGo:
         case HighlighterState::CodeGo + tildeOffset:
         case HighlighterState::CodeGoComment:
         case HighlighterState::CodeGoComment + tildeOffset:
-            loadGoData(types, keywords, builtin, literals, others);
+            langData = &goLanguageData();
             break;
         case HighlighterState::CodeV:
         case HighlighterState::CodeV + tildeOffset:
         case HighlighterState::CodeVComment:
         case HighlighterState::CodeVComment + tildeOffset:
-            loadVData(types, keywords, builtin, literals, others);
+            langData = &vLanguageData();
             break;
         case HighlighterState::CodeSQL:
         case HighlighterState::CodeSQL + tildeOffset:
-            loadSQLData(types, keywords, builtin, literals, others);
+            langData = &sqlLanguageData();
             break;
         case HighlighterState::CodeJSON:
         case HighlighterState::CodeJSON + tildeOffset:
-            loadJSONData(types, keywords, builtin, literals, others);
+            langData = &jsonLanguageData();
             break;
         case HighlighterState::CodeXML:
         case HighlighterState::CodeXML + tildeOffset:
@@ -840,19 +2454,19 @@ void MarkdownHighlighter::highlightSyntax(const QString &text) {
         case HighlighterState::CodeCSSComment:
         case HighlighterState::CodeCSSComment + tildeOffset:
             isCSS = true;
-            loadCSSData(types, keywords, builtin, literals, others);
+            langData = &cssLanguageData();
             break;
         case HighlighterState::CodeTypeScript:
         case HighlighterState::CodeTypeScript + tildeOffset:
         case HighlighterState::CodeTypeScriptComment:
         case HighlighterState::CodeTypeScriptComment + tildeOffset:
-            loadTypescriptData(types, keywords, builtin, literals, others);
+            langData = &typescriptLanguageData();
             break;
         case HighlighterState::CodeYAML:
         case HighlighterState::CodeYAML + tildeOffset:
             isYAML = true;
             comment = QLatin1Char('#');
-            loadYAMLData(types, keywords, builtin, literals, others);
+            langData = &yamlLanguageData();
             break;
         case HighlighterState::CodeINI:
         case HighlighterState::CodeINI + tildeOffset:
@@ -866,17 +2480,17 @@ void MarkdownHighlighter::highlightSyntax(const QString &text) {
         case HighlighterState::CodeVex + tildeOffset:
         case HighlighterState::CodeVexComment:
         case HighlighterState::CodeVexComment + tildeOffset:
-            loadVEXData(types, keywords, builtin, literals, others);
+            langData = &vexLanguageData();
             break;
         case HighlighterState::CodeCMake:
         case HighlighterState::CodeCMake + tildeOffset:
-            loadCMakeData(types, keywords, builtin, literals, others);
+            langData = &cmakeLanguageData();
             comment = QLatin1Char('#');
             break;
         case HighlighterState::CodeMake:
         case HighlighterState::CodeMake + tildeOffset:
             isMake = true;
-            loadMakeData(types, keywords, builtin, literals, others);
+            langData = &makeLanguageData();
             comment = QLatin1Char('#');
             break;
         default:
@@ -887,13 +2501,15 @@ void MarkdownHighlighter::highlightSyntax(const QString &text) {
     // apply the default code block format first
     setFormat(0, textLen, _formats[CodeBlock]);
 
+    const LanguageData &lang = *langData;
+
     auto applyCodeFormat =
-        [this](int i, const QMultiHash<char, QLatin1String> &data,
+        [this](int i, const LanguageKeywords &data,
                const QString &text, const QTextCharFormat &fmt) -> int {
         // check if we are at the beginning OR if this is the start of a word
         if (i == 0 || (!text.at(i - 1).isLetterOrNumber() &&
                        text.at(i-1) != QLatin1Char('_'))) {
-            const auto wordList = data.values(text.at(i).toLatin1());
+            const auto wordList = data.wordsStartingWith(text.at(i).toLatin1());
             for (const QLatin1String &word : wordList) {
                 // we have a word match check
                 // 1. if we are at the end
@@ -985,7 +2601,7 @@ void MarkdownHighlighter::highlightSyntax(const QString &text) {
         if (i == textLen || !text[i].isLetter()) continue;
 
         /* Highlight Types */
-        i = applyCodeFormat(i, types, text, formatType);
+        i = applyCodeFormat(i, lang.types, text, formatType);
         /************************************************
          next letter is usually a space, in that case
          going forward is useless, so continue;
@@ -993,21 +2609,21 @@ void MarkdownHighlighter::highlightSyntax(const QString &text) {
         if (i == textLen || !text[i].isLetter()) continue;
 
         /* Highlight Keywords */
-        i = applyCodeFormat(i, keywords, text, formatKeyword);
+        i = applyCodeFormat(i, lang.keywords, text, formatKeyword);
         if (i == textLen || !text[i].isLetter()) continue;
 
         /* Highlight Literals (true/false/NULL,nullptr) */
-        i = applyCodeFormat(i, literals, text, formatNumLit);
+        i = applyCodeFormat(i, lang.literals, text, formatNumLit);
         if (i == textLen || !text[i].isLetter()) continue;
 
         /* Highlight Builtin library stuff */
-        i = applyCodeFormat(i, builtin, text, formatBuiltIn);
+        i = applyCodeFormat(i, lang.builtin, text, formatBuiltIn);
         if (i == textLen || !text[i].isLetter()) continue;
 
         /* Highlight other stuff (preprocessor etc.) */
         if (i == 0 || !text.at(i - 1).isLetter()) {
-            const QList<QLatin1String> wordList =
-                others.values(text[i].toLatin1());
+            const auto wordList =
+                lang.others.wordsStartingWith(text[i].toLatin1());
             for (const QLatin1String &word : wordList) {
                 if (word == text.midRef(i, word.size()) &&
                     (i + word.size() == text.length() ||
@@ -1048,8 +2664,8 @@ void MarkdownHighlighter::highlightSyntax(const QString &text) {
  * @param i pos of i in loop
  * @return pos of i after the string
  */
-int MarkdownHighlighter::highlightStringLiterals(QChar strType,
-                                                 const QString &text, int i) {
+int MarkdownHighlighter::Tokenizer::highlightStringLiterals(
+    QChar strType, const QString &text, int i) {
     setFormat(i, 1, _formats[CodeString]);
     ++i;
 
@@ -1152,7 +2768,8 @@ int MarkdownHighlighter::highlightStringLiterals(QChar strType,
  * @details it doesn't highlight the following yet:
  *  - 1000'0000
  */
-int MarkdownHighlighter::highlightNumericLiterals(const QString &text, int i) {
+int MarkdownHighlighter::Tokenizer::highlightNumericLiterals(
+    const QString &text, int i) {
     bool isPrefixAllowed = false;
     if (i == 0) {
         isPrefixAllowed = true;
@@ -1286,7 +2903,8 @@ int MarkdownHighlighter::highlightNumericLiterals(const QString &text, int i) {
  *
  * It has basic error detection when there is an unlcosed %Metadata Variable%
  */
-void MarkdownHighlighter::taggerScriptHighlighter(const QString &text) {
+void MarkdownHighlighter::Tokenizer::taggerScriptHighlighter(
+    const QString &text) {
     if (text.isEmpty()) return;
     const auto textLen = text.length();
 
@@ -1349,7 +2967,7 @@ void MarkdownHighlighter::taggerScriptHighlighter(const QString &text) {
  * If an h letter is found, check the next 4/5 letters for http/https and
  * highlight them as a link (underlined)
  */
-void MarkdownHighlighter::ymlHighlighter(const QString &text) {
+void MarkdownHighlighter::Tokenizer::ymlHighlighter(const QString &text) {
     if (text.isEmpty()) return;
     const auto textLen = text.length();
     bool colonNotFound = false;
@@ -1430,7 +3048,7 @@ void MarkdownHighlighter::ymlHighlighter(const QString &text) {
  * The loop is unrolled frequently upon a match. Before adding anything
  * new be sure to test in debug mode and apply bound checking as required.
  */
-void MarkdownHighlighter::iniHighlighter(const QString &text) {
+void MarkdownHighlighter::Tokenizer::iniHighlighter(const QString &text) {
     if (text.isEmpty()) return;
     const auto textLen = text.length();
 
@@ -1481,7 +3099,7 @@ void MarkdownHighlighter::iniHighlighter(const QString &text) {
     }
 }
 
-void MarkdownHighlighter::cssHighlighter(const QString &text) {
+void MarkdownHighlighter::Tokenizer::cssHighlighter(const QString &text) {
     if (text.isEmpty()) return;
     const auto textLen = text.length();
     for (int i = 0; i < textLen; ++i) {
@@ -1564,7 +3182,7 @@ void MarkdownHighlighter::cssHighlighter(const QString &text) {
     }
 }
 
-void MarkdownHighlighter::xmlHighlighter(const QString &text) {
+void MarkdownHighlighter::Tokenizer::xmlHighlighter(const QString &text) {
     if (text.isEmpty()) return;
     const auto textLen = text.length();
 
@@ -1615,7 +3233,7 @@ void MarkdownHighlighter::xmlHighlighter(const QString &text) {
     }
 }
 
-void MarkdownHighlighter::makeHighlighter(const QString &text) {
+void MarkdownHighlighter::Tokenizer::makeHighlighter(const QString &text) {
     const int colonPos = text.indexOf(QLatin1Char(':'));
     if (colonPos == -1) return;
     setFormat(0, colonPos, _formats[CodeBuiltIn]);
@@ -1626,21 +3244,22 @@ void MarkdownHighlighter::makeHighlighter(const QString &text) {
  *
  * @param text
  */
-void MarkdownHighlighter::highlightFrontmatterBlock(const QString &text) {
+void MarkdownHighlighter::Tokenizer::highlightFrontmatterBlock(
+    const QString &text) {
     if (text == QLatin1String("---")) {
         const bool foundEnd =
             previousBlockState() == HighlighterState::FrontmatterBlock;
 
         // return if the frontmatter block was already highlighted in previous
         // blocks, there just can be one frontmatter block
-        if (!foundEnd && document()->firstBlock() != currentBlock()) {
+        if (!foundEnd && _input.blockNumber != 0) {
             return;
         }
 
         setCurrentBlockState(foundEnd ? HighlighterState::FrontmatterBlockEnd
                                       : HighlighterState::FrontmatterBlock);
 
-        QTextCharFormat &maskedFormat =
+        const QTextCharFormat &maskedFormat =
             _formats[HighlighterState::MaskedSyntax];
         setFormat(0, text.length(), maskedFormat);
     } else if (previousBlockState() == HighlighterState::FrontmatterBlock) {
@@ -1654,7 +3273,8 @@ void MarkdownHighlighter::highlightFrontmatterBlock(const QString &text) {
  *
  * @param text
  */
-void MarkdownHighlighter::highlightCommentBlock(const QString &text) {
+void MarkdownHighlighter::Tokenizer::highlightCommentBlock(
+    const QString &text) {
     if (text.startsWith(QLatin1String("    ")) ||
         text.startsWith(QLatin1Char('\t')))
         return;
@@ -1687,7 +3307,8 @@ void MarkdownHighlighter::highlightCommentBlock(const QString &text) {
  * @brief Highlights thematic breaks i.e., horizontal ruler <hr/>
  * @param text
  */
-void MarkdownHighlighter::highlightThematicBreak(const QString &text) {
+void MarkdownHighlighter::Tokenizer::highlightThematicBreak(
+    const QString &text) {
     int i = 0;
     for (; i < 4 && i < text.length(); ++i) {
         if (text.at(i) != QLatin1Char(' '))
@@ -1721,59 +3342,32 @@ void MarkdownHighlighter::highlightThematicBreak(const QString &text) {
  * @brief Highlight lists in markdown
  * @param text - current text block
  */
-void MarkdownHighlighter::highlightLists(const QString &text) {
-    int spaces = 0;
-    while (spaces < text.length() && text.at(spaces).isSpace()) ++spaces;
+void MarkdownHighlighter::Tokenizer::highlightLists(const QString &text) {
+    MEASURE_PHASE(Stats::Lists);
 
-    if (spaces >= text.length()) return;
+    ListPrefix prefix;
+    if (!parseListPrefix(text, prefix)) return;
 
-    // check for start of list
-    if (text.at(spaces) != QLatin1Char('-') &&
-        text.at(spaces) != QLatin1Char('+') &&
-        text.at(spaces) != QLatin1Char('*') &&
-        !text.at(spaces).isNumber()) {    // ordered
+    const int spaces = prefix.indent;
+    const int markerEnd = spaces + prefix.markerLength;
+
+    // list markers are followed by a space
+    if (text.at(prefix.hasCheckBoxMarker() ? spaces + 1 : markerEnd) !=
+        QLatin1Char(' '))
         return;
-    }
 
     /* Ordered List */
-    if (text.at(spaces).isNumber()) {
-        int number = spaces;
-        while (number < text.length() && text.at(number).isNumber()) ++number;
-
-        if (number + 1 >= text.length()) return;
-        // there should be a '.' or ')' after a number
-        if ((text.at(number) == QLatin1Char('.') ||
-             text.at(number) == QLatin1Char(')')) &&
-            (text.at(number + 1) == QLatin1Char(' '))) {
-            setCurrentBlockState(List);
-            setFormat(spaces, number - spaces + 1, _formats[List]);
-        }
+    if (prefix.isOrdered()) {
+        setCurrentBlockState(List);
+        setFormat(spaces, prefix.markerLength, _formats[List]);
         return;
     }
 
-    if (spaces + 1 >= text.length()) return;
-    // check for a space after it
-    if (text.at(spaces + 1) != QLatin1Char(' ')) return;
-
     // check if we are in checkbox list
-    if (spaces + 2 < text.length() && text.at(spaces + 2) == QLatin1Char('[')) {
-        if (spaces + 4 >= text.length()) return;
-        const int start = spaces + 2;
-        constexpr int length = 3;
-        // checked checkbox
-        if (text.at(spaces + 3) == QLatin1Char('x') &&
-            text.at(spaces + 4) == QLatin1Char(']')) {
-            setFormat(start, length, _formats[CheckBoxChecked]);
-        }
-        // unchecked checkbox
-        else if (text.at(spaces + 3) == QLatin1Char(' ') &&
-                 text.at(spaces + 4) == QLatin1Char(']')) {
-            setFormat(start, length, _formats[CheckBoxUnChecked]);
-        }
-        // unchecked checkbox with no space bw brackets
-        else if (text.at(spaces + 3) == QLatin1Char(']')) {
-            setFormat(start, 2, _formats[CheckBoxUnChecked]);
-        }
+    if (prefix.checkBoxLength > 0) {
+        setFormat(spaces + 2, prefix.checkBoxLength,
+                  _formats[prefix.checked ? CheckBoxChecked
+                                          : CheckBoxUnChecked]);
     }
 
     /* Unordered List */
@@ -1788,9 +3382,9 @@ void MarkdownHighlighter::highlightLists(const QString &text) {
  * @param match The regex match
  * @param capturedGroup The captured group
  */
-void MarkdownHighlighter::setHeadingStyles(HighlighterState rule,
-                                           const QRegularExpressionMatch &match,
-                                           const int capturedGroup) {
+void MarkdownHighlighter::Tokenizer::setHeadingStyles(
+    HighlighterState rule, const QRegularExpressionMatch &match,
+    const int capturedGroup) {
     auto state = static_cast<HighlighterState>(currentBlockState());
     const QTextCharFormat &f = _formats[state];
 
@@ -1810,20 +3404,46 @@ void MarkdownHighlighter::setHeadingStyles(HighlighterState rule,
  *
  * @param text
  */
-void MarkdownHighlighter::highlightAdditionalRules(
+void MarkdownHighlighter::Tokenizer::highlightAdditionalRules(
     const QVector<HighlightingRule> &rules, const QString &text) {
-    const auto &maskedFormat = _formats[HighlighterState::MaskedSyntax];
+    MEASURE_PHASE(Stats::AdditionalRules);
+
     _linkRanges.clear();
 
+    // find the first position of every ascii character in a single pass,
+    // so rules whose shouldContain doesn't occur are skipped without
+    // scanning the text again
+    int firstPositions[128];
+    std::fill_n(firstPositions, 128, -1);
+    const QChar *data = text.constData();
+    for (int i = text.length() - 1; i >= 0; --i) {
+        const ushort c = data[i].unicode();
+        if (c < 128) firstPositions[c] = i;
+    }
+
     for (const HighlightingRule &rule : rules) {
         // continue if another current block state was already set if
         // disableIfCurrentStateIsSet is set
         if (currentBlockState() != NoState) continue;
 
-        const bool contains = text.contains(rule.shouldContain);
-        if (!contains) continue;
+        if ((_highlightingOptions & rule.options) != rule.options ||
+            (_highlightingOptions & rule.excludedOptions) != 0)
+            continue;
+
+        int shouldContainPos = 0;
+        if (!rule.shouldContain.isEmpty()) {
+            const ushort first = rule.shouldContain.at(0).unicode();
+            const int from = first < 128 ? firstPositions[first] : 0;
+            if (from < 0) continue;
+
+            shouldContainPos = text.indexOf(rule.shouldContain, from);
+            if (shouldContainPos < 0) continue;
+        }
 
-        auto iterator = rule.pattern.globalMatch(text);
+        // no match can start before the first occurrence of shouldContain
+        // if every match starts with it
+        auto iterator = rule.pattern.globalMatch(
+            text, rule.matchStartsWithShouldContain ? shouldContainPos : 0);
         const uint8_t capturingGroup = rule.capturingGroup;
         const uint8_t maskedGroup = rule.maskedGroup;
         const QTextCharFormat &format = _formats[rule.state];
@@ -1836,12 +3456,9 @@ void MarkdownHighlighter::highlightAdditionalRules(
             // everything as MaskedSyntax and highlight capturingGroup
             // with the real format
             if (capturingGroup > 0) {
-                QTextCharFormat currentMaskedFormat = maskedFormat;
-                // set the font size from the current rule's font format
-                if (format.fontPointSize() > 0) {
-                    currentMaskedFormat.setFontPointSize(
-                        format.fontPointSize());
-                }
+                // the masked format at the font size of the rule's format
+                const QTextCharFormat &currentMaskedFormat =
+                    _formats.masked(rule.state);
 
                 if (currentBlockState() >= H1 && currentBlockState() <= H6) {
                     // setHeadingStyles(format, match, maskedGroup);
@@ -1852,9 +3469,7 @@ void MarkdownHighlighter::highlightAdditionalRules(
                         const int start = match.capturedStart(maskedGroup);
                         const int end = match.capturedStart(maskedGroup) +
                                         match.capturedLength(maskedGroup);
-                        if (!_linkRanges.contains({start, end})) {
-                            _linkRanges.append({start, end});
-                        }
+                        _linkRanges.append({start, end});
                     }
 
                     setFormat(match.capturedStart(maskedGroup),
@@ -1871,24 +3486,110 @@ void MarkdownHighlighter::highlightAdditionalRules(
             }
         }
     }
+
+    // keep the link ranges sorted and without overlaps, so the inline
+    // rules can walk them along with the text
+    if (_linkRanges.size() > 1) {
+        std::sort(_linkRanges.begin(), _linkRanges.end());
+        int merged = 0;
+        for (int k = 1; k < _linkRanges.size(); ++k) {
+            const QPair<int, int> &range = _linkRanges.at(k);
+            QPair<int, int> &last = _linkRanges[merged];
+            if (range.first <= last.second) {
+                last.second = qMax(last.second, range.second);
+            } else {
+                _linkRanges[++merged] = range;
+            }
+        }
+        _linkRanges.resize(merged + 1);
+    }
 }
 
 /**
- * @brief helper function to check if we are in a link while highlighting inline
- * rules
- * @param pos
- * @param range
+ * @brief collects the positions of all characters that can start inline
+ * markup, i.e. ` ~ < * _
+ * @param text
  */
-int isInLinkRange(int pos, QVector<QPair<int, int>> &range) {
-    int j = 0;
-    for (const auto i : range) {
-        if (pos >= i.first && pos <= i.second) {
-            // return the length of the range so that we can skip it
-            const int len = i.second - i.first;
-            range.remove(j);
-            return len;
+static QVector<int> findInlineDelimiters(const QString &text) {
+    QVector<int> positions;
+    const ushort *data = text.utf16();
+    const int length = text.length();
+    int i = 0;
+
+#if defined(__SSE2__)
+    const __m128i backtick = _mm_set1_epi16('`');
+    const __m128i tilde = _mm_set1_epi16('~');
+    const __m128i lessThan = _mm_set1_epi16('<');
+    const __m128i star = _mm_set1_epi16('*');
+    const __m128i underscore = _mm_set1_epi16('_');
+
+    for (; i + 8 <= length; i += 8) {
+        const __m128i chunk =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        const __m128i matches = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi16(chunk, backtick),
+                         _mm_cmpeq_epi16(chunk, tilde)),
+            _mm_or_si128(_mm_cmpeq_epi16(chunk, lessThan),
+                         _mm_or_si128(_mm_cmpeq_epi16(chunk, star),
+                                      _mm_cmpeq_epi16(chunk, underscore))));
+
+        // two bits for every matching character
+        uint mask = static_cast<uint>(_mm_movemask_epi8(matches));
+        while (mask != 0) {
+            const uint bit = qCountTrailingZeroBits(mask);
+            positions.append(i + static_cast<int>(bit / 2));
+            mask &= ~(3u << bit);
+        }
+    }
+#elif defined(__ARM_NEON)
+    const uint16x8_t backtick = vdupq_n_u16('`');
+    const uint16x8_t tilde = vdupq_n_u16('~');
+    const uint16x8_t lessThan = vdupq_n_u16('<');
+    const uint16x8_t star = vdupq_n_u16('*');
+    const uint16x8_t underscore = vdupq_n_u16('_');
+
+    for (; i + 8 <= length; i += 8) {
+        const uint16x8_t chunk = vld1q_u16(data + i);
+        const uint16x8_t matches = vorrq_u16(
+            vorrq_u16(vceqq_u16(chunk, backtick), vceqq_u16(chunk, tilde)),
+            vorrq_u16(vceqq_u16(chunk, lessThan),
+                      vorrq_u16(vceqq_u16(chunk, star),
+                                vceqq_u16(chunk, underscore))));
+
+        // one byte for every matching character
+        quint64 mask = vget_lane_u64(
+            vreinterpret_u64_u8(vmovn_u16(matches)), 0);
+        while (mask != 0) {
+            const uint bit = qCountTrailingZeroBits(mask);
+            positions.append(i + static_cast<int>(bit / 8));
+            mask &= ~(Q_UINT64_C(0xff) << (bit & ~7u));
+        }
+    }
+#endif
+
+    for (; i < length; ++i) {
+        const ushort c = data[i];
+        if (c == '`' || c == '~' || c == '<' || c == '*' || c == '_') {
+            positions.append(i);
         }
-        ++j;
+    }
+
+    return positions;
+}
+
+/**
+ * @brief returns the next position of c1 or c2 at or after from, or -1
+ * @param text
+ * @param from
+ */
+int MarkdownHighlighter::Tokenizer::nextInlineDelimiter(const QString &text,
+                                                        int from, QChar c1,
+                                                        QChar c2) const {
+    auto it = std::lower_bound(_inlineDelimiters.cbegin(),
+                               _inlineDelimiters.cend(), from);
+    for (; it != _inlineDelimiters.cend(); ++it) {
+        const QChar c = text.at(*it);
+        if (c == c1 || c == c2) return *it;
     }
     return -1;
 }
@@ -1897,21 +3598,46 @@ int isInLinkRange(int pos, QVector<QPair<int, int>> &range) {
  * @brief highlight inline rules aka Emphasis, bolds, inline code spans,
  * underlines, strikethrough.
  */
-void MarkdownHighlighter::highlightInlineRules(const QString &text) {
+void MarkdownHighlighter::Tokenizer::highlightInlineRules(
+    const QString &text) {
+    MEASURE_PHASE(Stats::InlineRules);
+
     bool isEmStrongDone = false;
     bool inlineSpans = false;
 
+    // only the delimiter positions and the link ranges are visited
+    _inlineDelimiters = findInlineDelimiters(text);
+    int delimiterIndex = 0;
+    int linkRangeIndex = 0;
+
     // TODO: Add Links and Images parsing
     for (int i = 0; i < text.length(); ++i) {
-        // make sure we are not in a link range
-        if (!_linkRanges.isEmpty()) {
-            const int res = isInLinkRange(i, _linkRanges);
-            if (res > -1) {
-                i += res - 1;
-                continue;
-            }
+        // skip to the next delimiter
+        while (delimiterIndex < _inlineDelimiters.size() &&
+               _inlineDelimiters.at(delimiterIndex) < i) {
+            ++delimiterIndex;
+        }
+        const int nextDelimiter = delimiterIndex < _inlineDelimiters.size()
+                                      ? _inlineDelimiters.at(delimiterIndex)
+                                      : text.length();
+
+        // make sure we are not in a link range, skip it if it begins
+        // before the next delimiter
+        while (linkRangeIndex < _linkRanges.size() &&
+               _linkRanges.at(linkRangeIndex).second <= i) {
+            ++linkRangeIndex;
+        }
+        if (linkRangeIndex < _linkRanges.size() &&
+            _linkRanges.at(linkRangeIndex).first <= nextDelimiter &&
+            _linkRanges.at(linkRangeIndex).first < text.length()) {
+            i = _linkRanges.at(linkRangeIndex).second - 1;
+            ++linkRangeIndex;
+            continue;
         }
 
+        if (nextDelimiter >= text.length()) break;
+        i = nextDelimiter;
+
         if (!inlineSpans && (text.at(i) == QLatin1Char('`') ||
                              text.at(i) == QLatin1Char('~'))) {
 
@@ -1951,13 +3677,12 @@ void MarkdownHighlighter::highlightInlineRules(const QString &text) {
 ` foo `` bar `
 <code>foo `` bar</code>
 */
-void MarkdownHighlighter::highlightInlineSpans(const QString &text,
-                                              int currentPos, const QChar c) {
-    //clear code span ranges for this block
-    clearRangesForBlock(currentBlock().blockNumber(), RangeType::CodeSpan);
-
+void MarkdownHighlighter::Tokenizer::highlightInlineSpans(const QString &text,
+                                                          int currentPos,
+                                                          const QChar c) {
     for (int i = currentPos; i < text.length(); ++i) {
-        if (text.at(i) != c) continue;
+        i = nextInlineDelimiter(text, i, c, c);
+        if (i == -1) return;
 
         // found a backtick
         int len = 0;
@@ -1982,7 +3707,7 @@ void MarkdownHighlighter::highlightInlineSpans(const QString &text,
 
         //get existing format if any
         //we want to append to the existing format, not overwrite it
-        QTextCharFormat fmt = QSyntaxHighlighter::format(start + 1);
+        QTextCharFormat fmt = format(start + 1);
         QTextCharFormat inlineFmt;
 
         //select appropriate format for current text
@@ -2005,7 +3730,7 @@ void MarkdownHighlighter::highlightInlineSpans(const QString &text,
         }
 
         if (c == QLatin1Char('`')) {
-            _ranges[currentBlock().blockNumber()].append(InlineRange(start, next, RangeType::CodeSpan));
+            _codeSpans.append(InlineRange(start, next, RangeType::CodeSpan));
         }
 
         //format the text
@@ -2025,7 +3750,8 @@ void MarkdownHighlighter::highlightInlineSpans(const QString &text,
  * @param pos
  * @return position after the comment
  */
-int MarkdownHighlighter::highlightInlineComment(const QString &text, int pos) {
+int MarkdownHighlighter::Tokenizer::highlightInlineComment(const QString &text,
+                                                           int pos) {
     const int start = pos;
     pos += 4;
 
@@ -2159,57 +3885,172 @@ void balancePairs(QVector<Delimiter> &delims) {
     }
 }
 
-void MarkdownHighlighter::clearRangesForBlock(int blockNumber, RangeType type)
-{
-    if (!_ranges.value(blockNumber).isEmpty()) {
-        auto& rangeList = _ranges[currentBlock().blockNumber()];
-        rangeList.erase(std::remove_if(rangeList.begin(), rangeList.end(),
-                                       [type](const InlineRange& range) {
-           return range.type == type;
-        }), rangeList.end());
+bool MarkdownHighlighter::rangeBeginLessThan(const InlineRange &a,
+                                             const InlineRange &b) {
+    return a.begin < b.begin || (a.begin == b.begin && a.end < b.end);
+}
+
+bool MarkdownHighlighter::rangeEndLessThan(const InlineRange &a,
+                                           const InlineRange &b) {
+    return a.end < b.end || (a.end == b.end && a.begin < b.begin);
+}
+
+/**
+ * @brief Scans the list item prefix of a line without any allocations
+ *
+ * A list item is a "-", "+" or "*" bullet or a number followed by "." or
+ * ")", after optional whitespace and followed by at least one whitespace
+ * character. A bullet may be followed by a space and a "[ ]", "[x]" or "[]"
+ * checkbox.
+ *
+ * @param prefix gets the indent even if the line isn't a list item
+ * @return true if the line is a list item
+ */
+bool MarkdownHighlighter::parseListPrefix(const QString &text,
+                                          ListPrefix &prefix) {
+    prefix = ListPrefix();
+    const int length = text.length();
+
+    int i = 0;
+    while (i < length && text.at(i).isSpace()) ++i;
+    prefix.indent = i;
+
+    if (i >= length) return false;
+
+    const QChar c = text.at(i);
+    if (c.isDigit()) {
+        while (i < length && text.at(i).isDigit()) ++i;
+
+        // there should be a '.' or ')' after a number
+        if (i >= length ||
+            (text.at(i) != QLatin1Char('.') && text.at(i) != QLatin1Char(')')))
+            return false;
+
+        prefix.numberLength = i - prefix.indent;
+        ++i;
+    } else if (c == QLatin1Char('-') || c == QLatin1Char('+') ||
+               c == QLatin1Char('*')) {
+        ++i;
+
+        // " [x]", " [ ]" or " []"
+        if (i + 2 < length && text.at(i) == QLatin1Char(' ') &&
+            text.at(i + 1) == QLatin1Char('[')) {
+            const QChar mark = text.at(i + 2);
+            if (mark == QLatin1Char(']')) {
+                prefix.checkBoxLength = 2;
+            } else if ((mark == QLatin1Char('x') || mark == QLatin1Char(' ')) &&
+                       i + 3 < length && text.at(i + 3) == QLatin1Char(']')) {
+                prefix.checkBoxLength = 3;
+                prefix.checked = mark == QLatin1Char('x');
+            }
+        }
+    } else {
+        return false;
+    }
+
+    // the checkbox is only part of the marker if whitespace follows
+    const int checkBoxEnd = i + 1 + prefix.checkBoxLength;
+    if (prefix.checkBoxLength > 0 && checkBoxEnd < length &&
+        text.at(checkBoxEnd).isSpace()) {
+        i = checkBoxEnd;
     }
+
+    prefix.markerLength = i - prefix.indent;
+
+    int spacingEnd = i;
+    while (spacingEnd < length && text.at(spacingEnd).isSpace()) ++spacingEnd;
+    prefix.spacing = spacingEnd - i;
+
+    return prefix.spacing > 0;
+}
+
+/**
+ * @brief checks if position is inside one of the sorted, non-overlapping
+ * ranges
+ */
+bool MarkdownHighlighter::isPosInRanges(const QVector<InlineRange> &ranges,
+                                        int position) {
+    // the last range that begins before position is the only candidate
+    auto it = std::lower_bound(
+        ranges.cbegin(), ranges.cend(), position,
+        [](const InlineRange &range, int pos) { return range.begin < pos; });
+    if (it == ranges.cbegin()) return false;
+    --it;
+    return position > it->begin && position < it->end;
+}
+
+/**
+ * @brief looks for a range that begins or ends at position
+ * @param byBegin ranges sorted by begin
+ * @param byEnd the same ranges sorted by end
+ */
+static QPair<int, int> findRangeAt(
+    const QVector<MarkdownHighlighter::InlineRange> &byBegin,
+    const QVector<MarkdownHighlighter::InlineRange> &byEnd, int position) {
+    using InlineRange = MarkdownHighlighter::InlineRange;
+
+    auto begin = std::lower_bound(
+        byBegin.cbegin(), byBegin.cend(), position,
+        [](const InlineRange &range, int pos) { return range.begin < pos; });
+    if (begin != byBegin.cend() && begin->begin == position)
+        return {begin->begin, begin->end};
+
+    auto end = std::lower_bound(
+        byEnd.cbegin(), byEnd.cend(), position,
+        [](const InlineRange &range, int pos) { return range.end < pos; });
+    if (end != byEnd.cend() && end->end == position)
+        return {end->begin, end->end};
+
+    return {-1, -1};
+}
+
+/**
+ * @brief returns the inline ranges of a block, or nullptr if it has none
+ */
+const MarkdownHighlighter::BlockRanges *MarkdownHighlighter::blockRanges(
+    int blockNumber) const {
+    if (!document()) return nullptr;
+
+    const QTextBlock block = document()->findBlockByNumber(blockNumber);
+    const auto *data = dynamic_cast<MarkdownBlockData *>(block.userData());
+    return data != nullptr ? &data->ranges : nullptr;
 }
 
 QPair<int,int>
 MarkdownHighlighter::findPositionInRanges(MarkdownHighlighter::RangeType type,
                                      int blockNum, int pos) const {
-    const QVector<InlineRange> rangeList = _ranges.value(blockNum);
-    auto it = std::find_if(rangeList.cbegin(), rangeList.cend(),
-                                     [pos, type](const InlineRange& range){
-        if ((pos == range.begin || pos == range.end) && range.type == type)
-            return true;
-        return false;
-    });
-    if (it == rangeList.cend())
+    const BlockRanges *blockRanges = this->blockRanges(blockNum);
+    if (blockRanges == nullptr)
         return {-1, -1};
-    return { it->begin, it->end };
+
+    const BlockRanges &ranges = *blockRanges;
+    if (type == RangeType::CodeSpan) {
+        // code spans don't overlap, so they are sorted by begin and end
+        return findRangeAt(ranges.codeSpans, ranges.codeSpans, pos);
+    }
+    return findRangeAt(ranges.emphasisByBegin, ranges.emphasisByEnd, pos);
 }
 
 bool MarkdownHighlighter::isPosInACodeSpan(int blockNumber, int position) const
 {
-    const QVector<InlineRange> rangeList = _ranges.value(blockNumber);
-    return std::find_if(rangeList.cbegin(), rangeList.cend(),
-                                     [position](const InlineRange& range){
-        if (position > range.begin && position < range.end && range.type == RangeType::CodeSpan)
-            return true;
+    const BlockRanges *ranges = blockRanges(blockNumber);
+    if (ranges == nullptr)
         return false;
-    }) != rangeList.cend();
+    return isPosInRanges(ranges->codeSpans, position);
 }
 
 /**
  * @brief highlights Em/Strong in text editor
  */
-void MarkdownHighlighter::highlightEmAndStrong(const QString &text,
-                                               const int pos) {
-    clearRangesForBlock(currentBlock().blockNumber(), RangeType::Emphasis);
-
+void MarkdownHighlighter::Tokenizer::highlightEmAndStrong(const QString &text,
+                                                          const int pos) {
     // 1. collect all em/strong delimiters
     QVector<Delimiter> delims;
     for (int i = pos; i < text.length(); ++i) {
-        if (text.at(i) != QLatin1Char('_') && text.at(i) != QLatin1Char('*'))
-            continue;
+        i = nextInlineDelimiter(text, i, QLatin1Char('_'), QLatin1Char('*'));
+        if (i == -1) break;
 
-        bool isInCodeSpan = isPosInACodeSpan(currentBlock().blockNumber(), i);
+        bool isInCodeSpan = isPosInACodeSpan(i);
         if (isInCodeSpan)
             continue;
 
@@ -2250,28 +4091,16 @@ void MarkdownHighlighter::highlightEmAndStrong(const QString &text,
             const int boldLen = endDelim.pos - startDelim.pos;
             const bool underline = _highlightingOptions.testFlag(Underline) &&
                                    startDelim.marker == QLatin1Char('_');
-            while (k != (startDelim.pos + boldLen)) {
-                QTextCharFormat fmt = QSyntaxHighlighter::format(k);
-                // if we are in plain text, use the format's specified color
-                if (fmt.foreground() == QTextCharFormat().foreground())
-                    fmt.setForeground(_formats[Bold].foreground());
-                if (underline)
-                    fmt.setFontUnderline(true);
-                else
-                    fmt.setFontWeight(QFont::Bold);
-                setFormat(k, 1, fmt);
-                ++k;
-            }
+            applyEmphasis(k, startDelim.pos + boldLen, Bold, underline);
             masked.append({startDelim.pos - 1, 2});
             masked.append({endDelim.pos, 2});
 
-            int block = currentBlock().blockNumber();
-            _ranges[block].append(InlineRange(
+            _emphasisRanges.append(InlineRange(
                                       startDelim.pos,
                                       endDelim.pos + 1,
                                       RangeType::Emphasis
                                       ));
-            _ranges[block].append(InlineRange(
+            _emphasisRanges.append(InlineRange(
                                       startDelim.pos - 1,
                                       endDelim.pos,
                                       RangeType::Emphasis
@@ -2286,22 +4115,11 @@ void MarkdownHighlighter::highlightEmAndStrong(const QString &text,
             const bool underline = _highlightingOptions.testFlag(Underline) &&
                                    startDelim.marker == QLatin1Char('_');
             const int itLen = endDelim.pos - startDelim.pos;
-            while (k != (startDelim.pos + itLen)) {
-                QTextCharFormat fmt = QSyntaxHighlighter::format(k);
-                if (fmt.foreground() == QTextCharFormat().foreground())
-                    fmt.setForeground(_formats[Italic].foreground());
-                if (underline)
-                    fmt.setFontUnderline(true);
-                else
-                    fmt.setFontItalic(true);
-                setFormat(k, 1, fmt);
-                ++k;
-            }
+            applyEmphasis(k, startDelim.pos + itLen, Italic, underline);
             masked.append({startDelim.pos, 1});
             masked.append({endDelim.pos, 1});
 
-            int block = currentBlock().blockNumber();
-            _ranges[block].append(InlineRange(
+            _emphasisRanges.append(InlineRange(
                                       startDelim.pos,
                                       endDelim.pos,
                                       RangeType::Emphasis
@@ -2310,11 +4128,8 @@ void MarkdownHighlighter::highlightEmAndStrong(const QString &text,
     }
 
     // 4. Apply masked syntax
+    const QTextCharFormat &maskedFmt = _formats.masked(currentBlockState());
     for (int i = 0; i < masked.length(); ++i) {
-        QTextCharFormat maskedFmt = _formats[MaskedSyntax];
-        auto state = static_cast<HighlighterState>(currentBlockState());
-        if (_formats[state].fontPointSize() > 0)
-            maskedFmt.setFontPointSize(_formats[state].fontPointSize());
         setFormat(masked.at(i).first, masked.at(i).second, maskedFmt);
     }
 }
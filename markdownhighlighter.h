@@ -15,15 +15,25 @@
 
 #pragma once
 
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QMultiHash>
+#include <QPointer>
 #include <QRegularExpression>
+#include <QSharedPointer>
 #include <QSyntaxHighlighter>
+#include <QTextBlockUserData>
 #include <QTextCharFormat>
+#include <QTextCursor>
 
 QT_BEGIN_NAMESPACE
 class QTextDocument;
 
 QT_END_NAMESPACE
 
+class MarkdownBlockData;
+class MarkdownHighlightCache;
+
 class MarkdownHighlighter : public QSyntaxHighlighter {
     Q_OBJECT
 
@@ -40,7 +50,7 @@ class MarkdownHighlighter : public QSyntaxHighlighter {
         HighlightingOptions highlightingOptions = HighlightingOption::None);
 
     static inline QColor codeBlockBackgroundColor() {
-        const QBrush brush = _formats[CodeBlock].background();
+        const QBrush brush = _formatTable[CodeBlock].background();
 
         if (!brush.isOpaque()) {
             return QColor(Qt::transparent);
@@ -68,13 +78,94 @@ class MarkdownHighlighter : public QSyntaxHighlighter {
                state == MarkdownHighlighter::CodeBlockTildeEnd;
     }
 
+    /**
+     * @brief What a block is to the code block background painting
+     */
+    enum class CodeBlockKind {
+        None,
+        // the opening ``` or ~~~ line
+        Fence,
+        Content,
+        End
+    };
+
+    static CodeBlockKind codeBlockKind(const QTextBlock &block);
+
+    /**
+     * @brief A heading of the outline
+     */
+    struct Heading {
+        QTextBlock block;
+        // 1 to 6
+        int level;
+        // the text without the markers
+        QString title;
+    };
+
     enum class RangeType {
         CodeSpan,
         Emphasis
     };
 
+    struct InlineRange {
+        int begin;
+        int end;
+        RangeType type;
+        InlineRange() = default;
+        InlineRange(int begin_, int end_, RangeType type_) :
+            begin{begin_}, end{end_}, type{type_}
+        {}
+    };
+
+    /**
+     * @brief The inline ranges of a block, sorted for binary search lookups
+     */
+    struct BlockRanges {
+        // code spans don't overlap
+        QVector<InlineRange> codeSpans;
+        // emphasis ranges can be nested, so they are kept sorted both ways
+        QVector<InlineRange> emphasisByBegin;
+        QVector<InlineRange> emphasisByEnd;
+
+        bool isEmpty() const {
+            return codeSpans.isEmpty() && emphasisByBegin.isEmpty();
+        }
+    };
+
+    static bool rangeBeginLessThan(const InlineRange &a, const InlineRange &b);
+    static bool rangeEndLessThan(const InlineRange &a, const InlineRange &b);
+    static bool isPosInRanges(const QVector<InlineRange> &ranges,
+                              int position);
+
+    /**
+     * @brief The list item prefix of a line, e.g. "  - [x] " or "12. "
+     */
+    struct ListPrefix {
+        // the leading whitespace
+        int indent = 0;
+        // the bullet, the number with its "." or ")" or the bullet with a
+        // checkbox that is followed by whitespace
+        int markerLength = 0;
+        // the whitespace after the marker
+        int spacing = 0;
+        // the digits of an ordered list item
+        int numberLength = 0;
+        // a checkbox after the bullet, even if it is not part of the marker
+        int checkBoxLength = 0;
+        bool checked = false;
+
+        bool isOrdered() const { return numberLength > 0; }
+        bool hasCheckBoxMarker() const {
+            return !isOrdered() && markerLength > 1;
+        }
+        int length() const { return indent + markerLength + spacing; }
+    };
+
+    static bool parseListPrefix(const QString &text, ListPrefix &prefix);
+
     QPair<int, int> findPositionInRanges(MarkdownHighlighter::RangeType type, int blockNum, int pos) const;
     bool isPosInACodeSpan(int blockNumber, int position) const;
+    const BlockRanges *blockRanges(int blockNumber) const;
 
     // we used some predefined numbers here to be compatible with
     // the peg-markdown parser
@@ -123,6 +214,7 @@ class MarkdownHighlighter : public QSyntaxHighlighter {
         CodeBlockEnd = 100,
         HeadlineEnd,
         FrontmatterBlockEnd,
+        LazyHighlightingPending,
 
         // languages
         /*********
@@ -172,17 +264,162 @@ class MarkdownHighlighter : public QSyntaxHighlighter {
     };
     Q_ENUMS(HighlighterState)
 
+    /**
+     * @brief A format for a span of a block
+     */
+    struct FormatRange {
+        int start;
+        int length;
+        QTextCharFormat format;
+    };
+
+    /**
+     * @brief The stages in which the expensive passes of the tokenizer are
+     * skipped, each stage also skips the passes of the ones before
+     */
+    enum class Degradation {
+        None,
+        // no regular expression rules
+        NoAdditionalRules,
+        // no emphasis, code spans and other inline rules either
+        NoInlineRules,
+        // code block lines only get the code block format
+        NoSyntax
+    };
+
+    /**
+     * @brief When blocks are highlighted in a stage of Degradation, every
+     * limit can be disabled with 0
+     */
+    struct DegradationPolicy {
+        // blocks longer than this are highlighted in the stage
+        int noAdditionalRulesBlockLength = 10000;
+        int noInlineRulesBlockLength = 30000;
+        int noSyntaxBlockLength = 100000;
+        // milliseconds after which the passes of a block that didn't run
+        // yet are skipped
+        int blockTimeBudget = 100;
+        // all blocks of documents with more characters than this are
+        // highlighted in the stage
+        int noAdditionalRulesDocumentSize = 32 * 1024 * 1024;
+        int noInlineRulesDocumentSize = 128 * 1024 * 1024;
+        int noSyntaxDocumentSize = 0;
+    };
+
+    /**
+     * @brief Everything the tokenizer needs to know about a block
+     */
+    struct BlockInput {
+        QString text;
+        QString previousText;
+        QString nextText;
+        int previousState = NoState;
+        int blockNumber = 0;
+        // the stage the block is highlighted in at least
+        Degradation degradation = Degradation::None;
+        // see DegradationPolicy::blockTimeBudget, it doesn't change the
+        // result of blocks that stay within it
+        int timeBudget = 0;
+    };
+
+    /**
+     * @brief Highlighting statistics, they are only collected if the
+     * highlighter is built with MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+     */
+    struct Stats {
+        enum Phase {
+            AdditionalRules,
+            Headline,
+            Lists,
+            InlineRules,
+            Syntax,
+            PhaseCount
+        };
+
+        // time spent in the highlighting phases
+        qint64 phaseNsecs[PhaseCount] = {};
+        // time spent in highlightSyntax() by code block state
+        QHash<int, qint64> syntaxNsecsByState;
+        // a batch is everything highlighted until highlightingFinished()
+        int highlightedBlocks = 0;
+        int lastBatchHighlightedBlocks = 0;
+        int dirtyBlockCount = 0;
+        int maxDirtyBlockCount = 0;
+    };
+
+    /**
+     * @brief What the tokenizer found out about a block
+     */
+    struct BlockResult {
+        // non-overlapping and in order
+        QVector<FormatRange> formats;
+        BlockRanges ranges;
+        int state = NoState;
+        // setext headlines change the state of the previous block
+        int previousState = NoState;
+        bool previousStateChanged = false;
+        // the [id]: url reference definition of the block, if any
+        QString referenceId;
+        QString referenceUrl;
+        // the stage the block was highlighted in, it is above the one of
+        // the input if the time budget was exceeded
+        Degradation degradation = Degradation::None;
+        // only filled in with MARKDOWNHIGHLIGHTER_INSTRUMENTATION, but always
+        // there, so the layout doesn't depend on how the library was built
+        qint64 phaseNsecs[Stats::PhaseCount] = {};
+        // the code block state highlightSyntax() ran for
+        int syntaxState = NoState;
+    };
+
+    static BlockResult tokenizeBlock(const BlockInput &input,
+                                     HighlightingOptions options);
+    static QVector<BlockResult> tokenizeText(
+        const QString &text,
+        HighlightingOptions options = HighlightingOption::None);
+    static QString toHtml(
+        const QString &text,
+        HighlightingOptions options = HighlightingOption::None);
+
     static void setTextFormats(
         QHash<HighlighterState, QTextCharFormat> formats);
     static void setTextFormat(HighlighterState state, QTextCharFormat format);
+    static QByteArray formatsFingerprint();
+    void setHighlightCache(MarkdownHighlightCache *cache);
+    MarkdownHighlightCache *highlightCache() const { return _highlightCache; }
     void clearDirtyBlocks();
     void setHighlightingOptions(const HighlightingOptions options);
-    void initHighlightingRules();
+    void setRehighlightTimeBudget(int msecs);
+    void setLazyHighlighting(bool enabled);
+    bool lazyHighlighting() const { return _lazyHighlighting; }
+    bool hasPendingBlocks() const;
+    bool hasDeferredCascades() const { return !_deferredCascades.isEmpty(); }
+    void setVisibleBlockRange(int firstBlockNumber, int lastBlockNumber);
+    void setDegradationPolicy(const DegradationPolicy &policy);
+    DegradationPolicy degradationPolicy() const { return _degradationPolicy; }
+    Degradation degradation() const { return _degradation; }
+    void rehighlightConcurrently();
+    QString referenceUrl(const QString &referenceId) const;
+    QVector<Heading> outline() const;
+    int headingCount() const;
+    Heading heading(int index) const;
+    int headingIndexAt(int position) const;
+    Stats stats() const;
+    void resetStats();
    signals:
     void highlightingFinished();
+    // the code block kind of a block changed
+    void codeBlocksChanged();
+    // the headings first up to last of the outline were added, removed or
+    // changed, last is first - 1 if headings were only removed at the end
+    void outlineChanged(int first, int last);
+    // the stage of the most degraded block changed
+    void degradationChanged(MarkdownHighlighter::Degradation degradation);
+    // stats() changed, only emitted with MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+    void statsUpdated();
 
    protected slots:
     void timerTick();
+    void applyConcurrentRehighlight();
 
    protected:
     struct HighlightingRule {
@@ -195,108 +432,385 @@ class MarkdownHighlighter : public QSyntaxHighlighter {
         HighlighterState state = NoState;
         uint8_t capturingGroup = 0;
         uint8_t maskedGroup = 0;
+        // every match starts with shouldContain, so matching can start
+        // at its first occurrence
+        bool matchStartsWithShouldContain = false;
+        // the rule is only used by highlighters with all of these options
+        // and none of the excluded ones
+        HighlightingOptions options;
+        HighlightingOptions excludedOptions;
     };
-    struct InlineRange {
-        int begin;
-        int end;
-        RangeType type;
-        InlineRange() = default;
-        InlineRange(int begin_, int end_, RangeType type_) :
-            begin{begin_}, end{end_}, type{type_}
-        {}
-    };
-
 
     void highlightBlock(const QString &text) Q_DECL_OVERRIDE;
 
+    void highlightCurrentBlock(const QString &text);
+
+    void updateCodeFence(const QString &text);
+
+    static void initHighlightingRules();
+
     static void initTextFormats(int defaultFontSize = 12);
 
+    /**
+     * @brief The text formats in a flat array indexed by state, together
+     * with the formats derived from them, it is rebuilt whenever the text
+     * formats change
+     */
+    class FormatTable {
+       public:
+        FormatTable()
+            : _formats(formatTableSize), _maskedFormats(formatTableSize) {}
+
+        const QTextCharFormat &operator[](int state) const {
+            const int index = formatIndex(state);
+            return index < 0 ? _empty : _formats.at(index);
+        }
+
+        // MaskedSyntax at the font size of the format of a state
+        const QTextCharFormat &masked(int state) const {
+            const int index = formatIndex(state);
+            return _maskedFormats.at(index < 0 ? formatIndex(MaskedSyntax)
+                                               : index);
+        }
+
+        void rebuild(const QHash<HighlighterState, QTextCharFormat> &formats);
+
+       private:
+        static int formatIndex(int state);
+
+        // NoState up to the internal states, the code languages with and
+        // without tildeOffset and the code tokens
+        static constexpr int formatTableSize = 105 + 100 + 100 + 7;
+
+        QVector<QTextCharFormat> _formats;
+        QVector<QTextCharFormat> _maskedFormats;
+        QTextCharFormat _empty;
+    };
+
+    static void updateFormatTable();
+
     static void initCodeLangs();
 
+    static void initStaticData();
+
+    static void waitForConcurrentJobs();
+
     void highlightMarkdown(const QString &text);
 
-    /******************************
-     *  BLOCK LEVEL FUNCTIONS
-     ******************************/
+    void applyBlockResult(const BlockResult &result);
+
+    void updateReferenceDefinition(MarkdownBlockData *data,
+                                   const BlockResult &result);
+
+    void removeReferenceDefinition(MarkdownBlockData *data);
+
+    void updateHeading();
+
+    static QString headingTitle(const QString &text);
+
+    int outlineLowerBound(int blockNumber) const;
+
+    void removeHeading(MarkdownBlockData *data);
+
+    void compactOutline() const;
+
+    void emitOutlineChanged();
+
+    BlockInput blockInput(const QTextBlock &block) const;
+
+    void updateBlockDegradation(MarkdownBlockData *data,
+                                Degradation degradation);
+
+    void emitDegradationChanged();
+
+    /**
+     * @brief Tokenizes a single block, it only depends on the block input
+     * (and the static formats and rules) and not on the document
+     */
+    class Tokenizer {
+       public:
+        Tokenizer(const BlockInput &input, HighlightingOptions options);
+
+        BlockResult tokenize();
+
+       private:
+        void setFormat(int start, int count, const QTextCharFormat &format);
+
+        QTextCharFormat format(int position) const;
+
+        void applyEmphasis(int start, int end, HighlighterState emphasis,
+                           bool underline);
+
+        QTextCharFormat emphasisFormat(const QTextCharFormat &base,
+                                       HighlighterState emphasis,
+                                       bool underline);
+
+        int previousBlockState() const { return _previousState; }
 
-    void highlightHeadline(const QString &text);
+        void setPreviousBlockState(int state);
 
-    void highlightSubHeadline(const QString &text, HighlighterState state);
+        int currentBlockState() const { return _state; }
 
-    void highlightAdditionalRules(const QVector<HighlightingRule> &rules,
-                                  const QString &text);
+        void setCurrentBlockState(int state) { _state = state; }
 
-    void highlightFrontmatterBlock(const QString &text);
+        bool isSkipped(Degradation stage);
 
-    void highlightCommentBlock(const QString &text);
+        bool isPosInACodeSpan(int position) const;
 
-    void highlightThematicBreak(const QString &text);
+        int nextInlineDelimiter(const QString &text, int from, QChar c1,
+                                QChar c2) const;
 
-    void highlightLists(const QString &text);
+        void highlightMarkdown(const QString &text);
 
-    /******************************
-     *  INLINE FUNCTIONS
-     ******************************/
+        /******************************
+         *  BLOCK LEVEL FUNCTIONS
+         ******************************/
 
-    void highlightInlineRules(const QString &text);
+        void highlightHeadline(const QString &text);
 
-    void highlightInlineSpans(const QString &text,
-                                               int currentPos, const QChar c);
+        void highlightSubHeadline(const QString &text,
+                                  HighlighterState state);
 
-    void highlightEmAndStrong(const QString &text, const int pos);
+        void highlightAdditionalRules(const QVector<HighlightingRule> &rules,
+                                      const QString &text);
 
-    Q_REQUIRED_RESULT int highlightInlineComment(const QString &text, int pos);
+        void highlightFrontmatterBlock(const QString &text);
 
-    void setHeadingStyles(MarkdownHighlighter::HighlighterState rule,
-                          const QRegularExpressionMatch &match,
-                          const int capturedGroup);
+        void highlightCommentBlock(const QString &text);
 
-    /******************************
-     *  CODE HIGHLIGHTING FUNCTIONS
-     ******************************/
+        void highlightThematicBreak(const QString &text);
 
-    void highlightIndentedCodeBlock(const QString &text);
+        void highlightLists(const QString &text);
 
-    void highlightCodeFence(const QString &text);
+        void parseReferenceDefinition(const QString &text);
 
-    void highlightCodeBlock(const QString &text,
-                            const QString &opener = QStringLiteral("```"));
+        /******************************
+         *  INLINE FUNCTIONS
+         ******************************/
 
-    void highlightSyntax(const QString &text);
+        void highlightInlineRules(const QString &text);
 
-    Q_REQUIRED_RESULT int highlightNumericLiterals(const QString &text, int i);
+        void highlightInlineSpans(const QString &text, int currentPos,
+                                  const QChar c);
 
-    Q_REQUIRED_RESULT int highlightStringLiterals(QChar strType,
-                                                  const QString &text, int i);
+        void highlightEmAndStrong(const QString &text, const int pos);
 
-    void ymlHighlighter(const QString &text);
+        Q_REQUIRED_RESULT int highlightInlineComment(const QString &text,
+                                                     int pos);
 
-    void iniHighlighter(const QString &text);
+        void setHeadingStyles(MarkdownHighlighter::HighlighterState rule,
+                              const QRegularExpressionMatch &match,
+                              const int capturedGroup);
 
-    void cssHighlighter(const QString &text);
+        /******************************
+         *  CODE HIGHLIGHTING FUNCTIONS
+         ******************************/
 
-    void xmlHighlighter(const QString &text);
+        void highlightIndentedCodeBlock(const QString &text);
 
-    void makeHighlighter(const QString &text);
+        void highlightCodeFence(const QString &text);
 
-    void taggerScriptHighlighter(const QString &text);
+        void highlightCodeBlock(
+            const QString &text,
+            const QString &opener = QStringLiteral("```"));
 
-    void addDirtyBlock(const QTextBlock &block);
+        void highlightSyntax(const QString &text);
+
+        Q_REQUIRED_RESULT int highlightNumericLiterals(const QString &text,
+                                                       int i);
+
+        Q_REQUIRED_RESULT int highlightStringLiterals(QChar strType,
+                                                      const QString &text,
+                                                      int i);
+
+        void ymlHighlighter(const QString &text);
+
+        void iniHighlighter(const QString &text);
+
+        void cssHighlighter(const QString &text);
+
+        void xmlHighlighter(const QString &text);
+
+        void makeHighlighter(const QString &text);
+
+        void taggerScriptHighlighter(const QString &text);
+
+        const BlockInput &_input;
+        const HighlightingOptions _highlightingOptions;
+        // shadows the static formats, so they are only read
+        const FormatTable &_formats;
+        QVector<QTextCharFormat> _formatChanges;
+        struct EmphasisFormat {
+            QTextCharFormat base;
+            HighlighterState emphasis;
+            bool underline;
+            QTextCharFormat format;
+        };
+        // the formats built by emphasisFormat()
+        QVector<EmphasisFormat> _emphasisFormats;
+        // code spans are sorted, emphasis ranges get sorted at the end
+        QVector<InlineRange> _codeSpans;
+        QVector<InlineRange> _emphasisRanges;
+        // positions of the characters that can start inline markup
+        QVector<int> _inlineDelimiters;
+        // sorted and non-overlapping
+        QVector<QPair<int, int>> _linkRanges;
+        int _previousState;
+        int _state;
+        bool _previousStateChanged;
+        QString _referenceId;
+        QString _referenceUrl;
+        Degradation _degradation;
+        // started if the input has a time budget
+        QElapsedTimer _timer;
+        qint64 _phaseNsecs[Stats::PhaseCount] = {};
+        int _syntaxState = NoState;
+    };
+
+    struct PrecomputedBlock {
+        BlockInput input;
+        BlockResult result;
+    };
+
+    // the blocks a rehighlightConcurrently() job tokenizes and the document
+    // state they were taken from
+    struct ConcurrentRehighlight {
+        QVector<PrecomputedBlock> blocks;
+        const QTextDocument *document;
+        int revision;
+        int formatsGeneration;
+    };
+
+    void addDirtyBlock(QTextBlock block);
 
     void reHighlightDirtyBlocks();
 
-    void clearRangesForBlock(int blockNumber, RangeType type);
+    void scheduleTimerTick();
+
+    void clearDirtyBlockQueue();
+
+    bool isBlockDeferred(int blockNumber) const;
+
+    void highlightPendingBlocks();
+
+    bool isCascadeDeferred(int blockNumber) const;
+
+    void deferCascadeBlock();
+
+    void highlightDeferredCascades();
 
     bool _highlightingFinished;
     HighlightingOptions _highlightingOptions;
-    QTimer *_timer;
-    QVector<QTextBlock> _dirtyTextBlocks;
-    QVector<QPair<int,int>> _linkRanges;
-
-    QHash<int, QVector<InlineRange>> _ranges;
+    int _rehighlightTimeBudget;
+    // created by scheduleTimerTick()
+    QTimer *_timer = nullptr;
+    // dirty blocks in the order they were marked, they are deduplicated by
+    // MarkdownBlockData::dirtyGeneration, which moves with its block
+    // through edits
+    QVector<QTextBlock> _dirtyBlocks;
+    int _dirtyBlockCount;
+    // bumped when the queue is cleared, 0 is never a generation
+    int _dirtyGeneration = 1;
+    // the next entry of _dirtyBlocks to re-highlight
+    int _nextDirtyBlock;
+    // lazy highlighting: blocks before _lazyCursor are known to be
+    // highlighted, the ones around the visible range are highlighted
+    // right away
+    bool _lazyHighlighting;
+    int _lazyCursor;
+    int _lazyBlockCount;
+    int _lazyFillBlockNumber;
+    int _firstVisibleBlockNumber;
+    int _lastVisibleBlockNumber;
+    // blocks that QSyntaxHighlighter would have re-highlighted right away
+    // because the state of their previous block changed, only the blocks
+    // around the visible range are, the cursors point to where the rest of
+    // those cascades continues in the background
+    bool _visibleBlockRangeKnown = false;
+    int _lastHighlightedBlockNumber = -1;
+    bool _lastHighlightedStateChanged = false;
+    QVector<QTextCursor> _deferredCascades;
+    int _cascadeFillBlockNumber = -1;
+    // restarted by every edit that defers a cascade
+    QElapsedTimer _cascadeTimer;
+    // results of rehighlightConcurrently() by block number
+    QVector<PrecomputedBlock> _precomputedBlocks;
+    // the running rehighlightConcurrently() job, the worker threads keep it
+    // alive until they are done
+    QSharedPointer<ConcurrentRehighlight> _concurrentRehighlight;
+    // created by the first rehighlightConcurrently()
+    QFutureWatcher<void> *_concurrentWatcher = nullptr;
+    // the blocks with reference definitions by reference id
+    QMultiHash<QString, MarkdownBlockData *> _referenceDefinitions;
+    // the blocks with headings in document order, removed headings are
+    // nullptr until the outline is compacted
+    mutable QVector<MarkdownBlockData *> _outline;
+    mutable int _outlineRemovedCount = 0;
+    // headings before this index didn't change since outlineChanged(), -1
+    // if none did
+    int _outlineChangedFrom = -1;
+    mutable bool _outlineTailRemoved = false;
+    // where the next removed heading is looked for first, blocks are
+    // usually removed in a row
+    int _outlineRemovalHint = 0;
+    DegradationPolicy _degradationPolicy;
+    // the stage all blocks are highlighted in because of the document size
+    Degradation _documentDegradation = Degradation::None;
+    // the number of blocks in each stage after Degradation::None
+    int _degradedBlockCounts[3] = {};
+    Degradation _degradation = Degradation::None;
+    // not owned, it can be shared by several highlighters
+    MarkdownHighlightCache *_highlightCache = nullptr;
+    // only collected with MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+    Stats _stats;
+    int _batchHighlightedBlocks = 0;
 
     static QVector<HighlightingRule> _highlightingRules;
     static QHash<HighlighterState, QTextCharFormat> _formats;
+    static FormatTable _formatTable;
     static QHash<QString, HighlighterState> _langStringToEnum;
+    // bumped whenever _formats changes
+    static int _formatsGeneration;
+    // the rehighlightConcurrently() jobs that may still read the static
+    // rules and formats, they are waited for before those change
+    static QVector<QFuture<void>> _concurrentJobs;
     static constexpr int tildeOffset = 300;
+    static constexpr int defaultRehighlightTimeBudget = 4;
+    static constexpr int lazyHighlightingMargin = 100;
+    static constexpr int cascadeHighlightingMargin = 100;
+    // deferred cascades wait for this many milliseconds without edits, so
+    // a code fence that is about to be closed again doesn't highlight the
+    // rest of the document twice
+    static constexpr int cascadeSettleTime = 500;
+
+    friend class MarkdownBlockData;
+};
+
+/**
+ * @brief Highlighting data of a block, it is attached to the block so it
+ * moves and gets deleted with it
+ */
+class MarkdownBlockData : public QTextBlockUserData {
+   public:
+    ~MarkdownBlockData() override;
+
+    MarkdownHighlighter::BlockRanges ranges;
+    QString referenceId;
+    QString referenceUrl;
+    // the heading of the block, headingLevel is 0 if it isn't one
+    int headingLevel = 0;
+    QString headingTitle;
+    // changed since the last outlineChanged()
+    bool headingChanged = false;
+    MarkdownHighlighter::Degradation degradation =
+        MarkdownHighlighter::Degradation::None;
+    // the block is the opening ``` or ~~~ line of a code block
+    bool codeFence = false;
+    // the block is queued in the dirty blocks of the highlighter if this is
+    // its current generation
+    int dirtyGeneration = 0;
+    // the block itself, while it has a heading
+    QTextBlock block;
+    // the highlighter that indexed the reference definition and the heading
+    QPointer<MarkdownHighlighter> highlighter;
 };
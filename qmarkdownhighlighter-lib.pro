@@ -0,0 +1,13 @@
+TARGET = QMarkdownHighlighter
+TEMPLATE = lib
+QT = core gui concurrent
+CONFIG += c++11 staticlib
+
+include(qmarkdownhighlighter.pri)
+
+target.path = $$[QT_INSTALL_LIBS]
+
+headers.files = $$HEADERS
+headers.path = $$[QT_INSTALL_PREFIX]/include/$$TARGET/
+
+INSTALLS += target headers
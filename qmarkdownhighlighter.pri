@@ -0,0 +1,17 @@
+# the markdown highlighter without the editor widgets, e.g. for headless use
+INCLUDEPATH += $$PWD/
+
+QT += gui concurrent
+
+# collect highlighting statistics, see MarkdownHighlighter::stats()
+markdownhighlighter_instrumentation: DEFINES += MARKDOWNHIGHLIGHTER_INSTRUMENTATION
+
+HEADERS += \
+    $$PWD/markdownhighlighter.h \
+    $$PWD/markdownhighlightcache.h \
+    $$PWD/qownlanguagedata.h
+
+SOURCES += \
+    $$PWD/markdownhighlighter.cpp \
+    $$PWD/markdownhighlightcache.cpp \
+    $$PWD/qownlanguagedata.cpp
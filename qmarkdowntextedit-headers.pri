@@ -2,6 +2,7 @@ INCLUDEPATH += $$PWD/
 
 HEADERS += \
     $$PWD/markdownhighlighter.h \
+    $$PWD/markdownhighlightcache.h \
     $$PWD/qmarkdowntextedit.h \
     $$PWD/qownlanguagedata.h \
     $$PWD/qplaintexteditsearchwidget.h
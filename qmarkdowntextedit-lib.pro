@@ -1,6 +1,6 @@
 TARGET = QMarkdownTextedit
 TEMPLATE = lib
-QT += core gui widgets
+QT += core gui widgets concurrent
 CONFIG += c++11
 
 include(qmarkdowntextedit.pri)
@@ -1,10 +1,11 @@
 INCLUDEPATH += $$PWD/
 
 QT       += gui
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets concurrent
 
 SOURCES += \
     $$PWD/markdownhighlighter.cpp \
+    $$PWD/markdownhighlightcache.cpp \
     $$PWD/qmarkdowntextedit.cpp \
     $$PWD/qownlanguagedata.cpp \
     $$PWD/qplaintexteditsearchwidget.cpp
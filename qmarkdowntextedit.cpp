@@ -18,12 +18,15 @@
 #include <QDebug>
 #include <QDesktopServices>
 #include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
 #include <QGuiApplication>
 #include <QKeyEvent>
 #include <QWheelEvent>
 #include <QLayout>
 #include <QPainter>
 #include <QPainterPath>
+#include <QProcess>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
 #include <QRegularExpressionMatchIterator>
@@ -31,6 +34,7 @@
 #include <QSettings>
 #include <QTextBlock>
 #include <QTimer>
+#include <algorithm>
 #include <utility>
 
 #include "markdownhighlighter.h"
@@ -38,6 +42,11 @@
 static const QByteArray _openingCharacters = QByteArrayLiteral("([{<*\"'_~");
 static const QByteArray _closingCharacters = QByteArrayLiteral(")]}>*\"'_~");
 
+// the bytes loadFromDevice() reads at once and the time in milliseconds it
+// may spend on loading per event loop iteration
+static constexpr int loadChunkSize = 256 * 1024;
+static constexpr int loadTimeBudget = 15;
+
 QMarkdownTextEdit::QMarkdownTextEdit(QWidget *parent, bool initHighlighter)
     : QPlainTextEdit(parent) {
     installEventFilter(this);
@@ -46,8 +55,14 @@ QMarkdownTextEdit::QMarkdownTextEdit(QWidget *parent, bool initHighlighter)
 
     // markdown highlighting is enabled by default
     _highlightingEnabled = true;
+    _highlighter = nullptr;
     if (initHighlighter) {
         _highlighter = new MarkdownHighlighter(document());
+
+        // let the highlighter know what is visible, for lazy highlighting
+        // and for cutting off re-highlighting cascades
+        connect(verticalScrollBar(), &QScrollBar::valueChanged, this,
+                &QMarkdownTextEdit::updateHighlighterVisibleBlocks);
     }
     //    setHighlightingEnabled(true);
 
@@ -74,10 +89,6 @@ QMarkdownTextEdit::QMarkdownTextEdit(QWidget *parent, bool initHighlighter)
     layout->addStretch();
     this->setLayout(layout);
 
-    // add the hidden search widget
-    _searchWidget = new QPlainTextEditSearchWidget(this);
-    this->layout()->addWidget(_searchWidget);
-
     connect(this, &QPlainTextEdit::textChanged, this,
             &QMarkdownTextEdit::adjustRightMargin);
     connect(this, &QPlainTextEdit::cursorPositionChanged, this,
@@ -100,6 +111,12 @@ void QMarkdownTextEdit::setHighlightingEnabled(bool enabled) {
     }
 
     _highlightingEnabled = enabled;
+
+    // the highlighter is attached once the editor is shown
+    if (_deferHighlightingUntilShown && !_shown) {
+        return;
+    }
+
     _highlighter->setDocument(enabled ? document() : Q_NULLPTR);
 
     if (enabled) {
@@ -144,7 +161,8 @@ bool QMarkdownTextEdit::eventFilter(QObject *obj, QEvent *event) {
             return true;
         }
 
-        if ((keyEvent->key() == Qt::Key_Escape) && _searchWidget->isVisible()) {
+        if ((keyEvent->key() == Qt::Key_Escape) && _searchWidget != nullptr &&
+            _searchWidget->isVisible()) {
             _searchWidget->deactivate();
             return true;
         } else if ((keyEvent->key() == Qt::Key_Tab) ||
@@ -153,11 +171,11 @@ bool QMarkdownTextEdit::eventFilter(QObject *obj, QEvent *event) {
             return handleTabEntered(keyEvent->key() == Qt::Key_Backtab);
         } else if ((keyEvent->key() == Qt::Key_F) &&
                    keyEvent->modifiers().testFlag(Qt::ControlModifier)) {
-            _searchWidget->activate();
+            searchWidget()->activate();
             return true;
         } else if ((keyEvent->key() == Qt::Key_R) &&
                    keyEvent->modifiers().testFlag(Qt::ControlModifier)) {
-            _searchWidget->activateReplace();
+            searchWidget()->activateReplace();
             return true;
             //        } else if (keyEvent->key() == Qt::Key_Delete) {
         } else if (keyEvent->key() == Qt::Key_Backspace) {
@@ -250,9 +268,12 @@ bool QMarkdownTextEdit::eventFilter(QObject *obj, QEvent *event) {
                 return true;
             }
         } else if (keyEvent == QKeySequence::Paste) {
+            // a single line that was copied as a whole
+            const QString clipboardText = qApp->clipboard()->text();
             if (qApp->clipboard()->ownsClipboard() &&
-                QRegExp(QStringLiteral("[^\n]*\n$"))
-                    .exactMatch(qApp->clipboard()->text())) {
+                clipboardText.endsWith(QLatin1Char('\n')) &&
+                clipboardText.indexOf(QLatin1Char('\n')) ==
+                    clipboardText.length() - 1) {
                 QTextCursor cursor = this->textCursor();
                 if (!cursor.hasSelection()) {
                     cursor.movePosition(QTextCursor::StartOfBlock);
@@ -317,7 +338,7 @@ bool QMarkdownTextEdit::eventFilter(QObject *obj, QEvent *event) {
         } else if (keyEvent->key() == Qt::Key_Return) {
             return handleReturnEntered();
         } else if ((keyEvent->key() == Qt::Key_F3)) {
-            _searchWidget->doSearch(
+            searchWidget()->doSearch(
                 !keyEvent->modifiers().testFlag(Qt::ShiftModifier));
             return true;
         } else if ((keyEvent->key() == Qt::Key_Z) &&
@@ -489,63 +510,70 @@ void QMarkdownTextEdit::undo() {
 }
 
 void QMarkdownTextEdit::moveTextUpDown(bool up) {
-    QTextCursor cursor = textCursor();
-    QTextCursor move = cursor;
-
-    move.setVisualNavigation(false);
+    const QTextCursor cursor = textCursor();
+    QTextDocument *doc = document();
+    const bool hasSelection = cursor.hasSelection();
+
+    // if there's a selection inside the block, we move the whole block
+    const QTextBlock firstBlock = doc->findBlock(cursor.selectionStart());
+    QTextBlock lastBlock = doc->findBlock(cursor.selectionEnd());
+    if (hasSelection && lastBlock != firstBlock &&
+        cursor.selectionEnd() == lastBlock.position()) {
+        lastBlock = lastBlock.previous();
+    }
 
-    move.beginEditBlock();    // open an edit block to keep undo operations sane
-    bool hasSelection = cursor.hasSelection();
+    // instead of moving the selected blocks, the block next to them is
+    // moved to the other side, so only two places of the document change
+    const QTextBlock otherBlock = up ? firstBlock.previous() : lastBlock.next();
+    if (!otherBlock.isValid()) {
+        return;
+    }
 
-    if (hasSelection) {
-        // if there's a selection inside the block, we select the whole block
-        move.setPosition(cursor.selectionStart());
-        move.movePosition(QTextCursor::StartOfBlock);
-        move.setPosition(cursor.selectionEnd(), QTextCursor::KeepAnchor);
-        move.movePosition(
-            move.atBlockStart() ? QTextCursor::Left : QTextCursor::EndOfBlock,
-            QTextCursor::KeepAnchor);
+    // the blocks get merged and split, so only positions are used
+    const QString otherText = otherBlock.text();
+    const int otherLength = otherBlock.length();
+    const int blocksStart = firstBlock.position();
+    const int blocksEnd = lastBlock.position() + lastBlock.length() - 1;
+
+    // two edit blocks joined for undo, so the highlighter only gets the
+    // two changed places and not everything in between
+    QTextCursor move(doc);
+    move.beginEditBlock();
+    if (up) {
+        // the other block with its block separator
+        move.setPosition(blocksStart - otherLength);
+        move.setPosition(blocksStart, QTextCursor::KeepAnchor);
     } else {
-        move.movePosition(QTextCursor::StartOfBlock);
-        move.movePosition(QTextCursor::EndOfBlock, QTextCursor::KeepAnchor);
+        // the block separator with the other block
+        move.setPosition(blocksEnd);
+        move.setPosition(blocksEnd + otherLength, QTextCursor::KeepAnchor);
     }
-
-    // get the text of the current block
-    QString text = move.selectedText();
-
-    move.movePosition(QTextCursor::Right, QTextCursor::KeepAnchor);
     move.removeSelectedText();
+    move.endEditBlock();
 
-    if (up) {    // up key
-        move.movePosition(QTextCursor::PreviousBlock);
+    move.joinPreviousEditBlock();
+    if (up) {
+        move.setPosition(blocksEnd - otherLength);
+        move.insertBlock();
+        move.insertText(otherText);
+    } else {
+        move.setPosition(blocksStart);
+        move.insertText(otherText);
         move.insertBlock();
-        move.movePosition(QTextCursor::Left);
-    } else {    // down key
-        move.movePosition(QTextCursor::EndOfBlock);
-        if (move.atBlockStart()) {    // empty block
-            move.movePosition(QTextCursor::NextBlock);
-            move.insertBlock();
-            move.movePosition(QTextCursor::Left);
-        } else {
-            move.insertBlock();
-        }
     }
-
-    int start = move.position();
-    move.clearSelection();
-    move.insertText(text);
-    int end = move.position();
+    move.endEditBlock();
 
     // reselect
+    const int start =
+        up ? blocksStart - otherLength : blocksStart + otherLength;
+    const int blocksLength = blocksEnd - blocksStart;
     if (hasSelection) {
-        move.setPosition(end);
+        move.setPosition(start + blocksLength);
         move.setPosition(start, QTextCursor::KeepAnchor);
     } else {
         move.setPosition(start);
     }
 
-    move.endEditBlock();
-
     setTextCursor(move);
 }
 
@@ -609,7 +637,12 @@ bool QMarkdownTextEdit::handleBracketClosing(const QChar openingCharacter,
 
     // get the current text from the block (inserted character not included)
     // Remove whitespace at start of string (e.g. in multilevel-lists).
-    const QString text = cursor.block().text().remove(QRegExp("^\\s+"));
+    const QString blockText = cursor.block().text();
+    int indent = 0;
+    while (indent < blockText.length() && blockText.at(indent).isSpace()) {
+        ++indent;
+    }
+    const QString text = blockText.mid(indent);
 
     const int pib = cursor.positionInBlock();
     bool isPreviousAsterisk = pib > 0 && pib < text.length() && text.at(pib - 1) == '*';
@@ -655,7 +688,9 @@ bool QMarkdownTextEdit::handleBracketClosing(const QChar openingCharacter,
 
     // Auto completion for ``` pair
     if (openingCharacter == QLatin1Char('`')) {
-        if (QRegExp(QStringLiteral("[^`]*``")).exactMatch(text)) {
+        // the line ends with its only two backticks
+        if (text.endsWith(QLatin1String("``")) &&
+            text.indexOf(QLatin1Char('`')) == text.length() - 2) {
             cursor.insertText(QStringLiteral("``"));
             cursorSubtract = 3;
         }
@@ -944,56 +979,74 @@ bool QMarkdownTextEdit::handleCharRemoval(MarkdownHighlighter::RangeType type,
 bool QMarkdownTextEdit::increaseSelectedTextIndention(
     bool reverse, const QString &indentCharacters) {
     QTextCursor cursor = this->textCursor();
-    QString selectedText = cursor.selectedText();
 
-    if (!selectedText.isEmpty()) {
-        // we need this strange newline character we are getting in the
-        // selected text for newlines
-        const QString newLine =
-            QString::fromUtf8(QByteArray::fromHex(QByteArrayLiteral("e280a9")));
-        QString newText;
-
-        if (reverse) {
-            // un-indent text
-
-            //          QSettings settings;
-            const int indentSize = indentCharacters == QStringLiteral("\t")
-                                       ? 4
-                                       : indentCharacters.count();
-
-            // remove leading \t or spaces in following lines
-            newText = selectedText.replace(
-                QRegularExpression(newLine + QStringLiteral("(\\t| {1,") +
-                                   QString::number(indentSize) +
-                                   QStringLiteral("})")),
-                QStringLiteral("\n"));
-
-            // remove leading \t or spaces in first line
-            newText.remove(QRegularExpression(QStringLiteral("^(\\t| {1,") +
-                                              QString::number(indentSize) +
-                                              QStringLiteral("})")));
-        } else {
-            // replace trailing new line to prevent an indent of the line after
-            // the selection
-            newText = selectedText.replace(
-                QRegularExpression(QRegularExpression::escape(newLine) +
-                                   QStringLiteral("$")),
-                QStringLiteral("\n"));
-
-            // indent text
-            newText.replace(newLine, QStringLiteral("\n") + indentCharacters)
-                .prepend(indentCharacters);
-
-            // remove trailing \t
-            newText.remove(QRegularExpression(QStringLiteral("\\t$")));
+    if (cursor.hasSelection()) {
+        QTextDocument *doc = document();
+        const int selectionStart = cursor.selectionStart();
+        const int selectionEnd = cursor.selectionEnd();
+        const QTextBlock firstBlock = doc->findBlock(selectionStart);
+        QTextBlock lastBlock = doc->findBlock(selectionEnd);
+
+        // don't indent the line after a selection that ends with a newline
+        if (lastBlock != firstBlock && selectionEnd == lastBlock.position()) {
+            lastBlock = lastBlock.previous();
         }
+        const int lastBlockNumber = lastBlock.blockNumber();
+
+        const int indentSize = indentCharacters == QStringLiteral("\t")
+                                   ? 4
+                                   : indentCharacters.count();
+
+        // only the indention of every line is changed, so the blocks and
+        // their highlighting data stay where they are
+        QTextCursor edit(doc);
+        edit.beginEditBlock();
+        int lengthChange = 0;
+
+        for (QTextBlock block = firstBlock;
+             block.isValid() && block.blockNumber() <= lastBlockNumber;
+             block = block.next()) {
+            // the first line is indented from the start of the selection
+            const int start = block == firstBlock ? selectionStart
+                                                  : block.position();
+
+            if (!reverse) {
+                edit.setPosition(start);
+                edit.insertText(indentCharacters);
+                lengthChange += indentCharacters.length();
+                continue;
+            }
 
-        // insert the new text
-        cursor.insertText(newText);
+            // remove a leading \t or up to indentSize spaces, but nothing
+            // after the selection
+            const QString text = block.text();
+            const int offset = start - block.position();
+            const int end = block.blockNumber() == lastBlockNumber
+                                ? selectionEnd + lengthChange - block.position()
+                                : text.length();
+            int length = 0;
+            if (offset < end && text.at(offset) == QLatin1Char('\t')) {
+                length = 1;
+            } else {
+                while (length < indentSize && offset + length < end &&
+                       text.at(offset + length) == QLatin1Char(' ')) {
+                    ++length;
+                }
+            }
+
+            if (length > 0) {
+                edit.setPosition(start);
+                edit.setPosition(start + length, QTextCursor::KeepAnchor);
+                edit.removeSelectedText();
+                lengthChange -= length;
+            }
+        }
+
+        edit.endEditBlock();
 
         // update the selection to the new text
-        cursor.setPosition(cursor.position() - newText.size(),
-                           QTextCursor::KeepAnchor);
+        cursor.setPosition(selectionEnd + lengthChange);
+        cursor.setPosition(selectionStart, QTextCursor::KeepAnchor);
         this->setTextCursor(cursor);
 
         return true;
@@ -1013,10 +1066,12 @@ bool QMarkdownTextEdit::increaseSelectedTextIndention(
             }
 
             // check for \t or space in front of cursor
-            QRegularExpression re(QStringLiteral("[\\t ]"));
-            QRegularExpressionMatch match = re.match(cursor.selectedText());
+            const auto isIndentCharacter = [](const QString &text) {
+                return text == QLatin1String("\t") ||
+                       text == QLatin1String(" ");
+            };
 
-            if (!match.hasMatch()) {
+            if (!isIndentCharacter(cursor.selectedText())) {
                 // (select to) check for \t or space after the cursor
                 cursor.setPosition(position);
 
@@ -1025,9 +1080,7 @@ bool QMarkdownTextEdit::increaseSelectedTextIndention(
                 }
             }
 
-            match = re.match(cursor.selectedText());
-
-            if (match.hasMatch()) {
+            if (isIndentCharacter(cursor.selectedText())) {
                 cursor.removeSelectedText();
             }
 
@@ -1093,8 +1146,8 @@ bool QMarkdownTextEdit::openLinkAtCursorPosition() {
  * @return
  */
 bool QMarkdownTextEdit::isValidUrl(const QString &urlString) {
-    const QRegularExpressionMatch match =
-        QRegularExpression(R"(^\w+:\/\/.+)").match(urlString);
+    static const QRegularExpression regex(QStringLiteral(R"(^\w+:\/\/.+)"));
+    const QRegularExpressionMatch match = regex.match(urlString);
     return match.hasMatch();
 }
 
@@ -1121,10 +1174,24 @@ void QMarkdownTextEdit::openUrl(const QString &urlString) {
 MarkdownHighlighter *QMarkdownTextEdit::highlighter() { return _highlighter; }
 
 /**
- * @brief Returns the searchWidget instance
+ * @brief Returns the searchWidget instance, it is created when it is
+ * needed for the first time
  * @return
  */
 QPlainTextEditSearchWidget *QMarkdownTextEdit::searchWidget() {
+    if (_searchWidget != nullptr) {
+        return _searchWidget;
+    }
+
+    _searchWidget = new QPlainTextEditSearchWidget(this);
+
+    if (_searchFrame != nullptr) {
+        _searchWidget->setDarkMode(_searchFrameDarkMode);
+        _searchFrame->layout()->addWidget(_searchWidget);
+    } else {
+        layout()->addWidget(_searchWidget);
+    }
+
     return _searchWidget;
 }
 
@@ -1146,13 +1213,13 @@ void QMarkdownTextEdit::setIgnoredClickUrlSchemata(
 QMap<QString, QString> QMarkdownTextEdit::parseMarkdownUrlsFromText(
     const QString &text) {
     QMap<QString, QString> urlMap;
-    QRegularExpression regex;
     QRegularExpressionMatchIterator iterator;
 
     // match urls like this: <http://mylink>
     //    re = QRegularExpression("(<(.+?:\\/\\/.+?)>)");
-    regex = QRegularExpression(QStringLiteral("(<(.+?)>)"));
-    iterator = regex.globalMatch(text);
+    static const QRegularExpression angleBracketUrlRegex(
+        QStringLiteral("(<(.+?)>)"));
+    iterator = angleBracketUrlRegex.globalMatch(text);
     while (iterator.hasNext()) {
         QRegularExpressionMatch match = iterator.next();
         QString linkText = match.captured(1);
@@ -1162,8 +1229,9 @@ QMap<QString, QString> QMarkdownTextEdit::parseMarkdownUrlsFromText(
 
     // match urls like this: [this url](http://mylink)
     //    QRegularExpression re("(\\[.*?\\]\\((.+?:\\/\\/.+?)\\))");
-    regex = QRegularExpression(R"((\[.*?\]\((.+?)\)))");
-    iterator = regex.globalMatch(text);
+    static const QRegularExpression inlineLinkRegex(
+        QStringLiteral(R"((\[.*?\]\((.+?)\)))"));
+    iterator = inlineLinkRegex.globalMatch(text);
     while (iterator.hasNext()) {
         QRegularExpressionMatch match = iterator.next();
         QString linkText = match.captured(1);
@@ -1172,8 +1240,9 @@ QMap<QString, QString> QMarkdownTextEdit::parseMarkdownUrlsFromText(
     }
 
     // match urls like this: http://mylink
-    regex = QRegularExpression(R"(\b\w+?:\/\/[^\s]+[^\s>\)])");
-    iterator = regex.globalMatch(text);
+    static const QRegularExpression plainUrlRegex(
+        QStringLiteral(R"(\b\w+?:\/\/[^\s]+[^\s>\)])"));
+    iterator = plainUrlRegex.globalMatch(text);
     while (iterator.hasNext()) {
         QRegularExpressionMatch match = iterator.next();
         QString url = match.captured(0);
@@ -1182,24 +1251,16 @@ QMap<QString, QString> QMarkdownTextEdit::parseMarkdownUrlsFromText(
 
     // match reference urls like this: [this url][1] with this later:
     // [1]: http://domain
-    regex = QRegularExpression(R"(\[(.*?)\]\[(.+?)\])");
-    iterator = regex.globalMatch(text);
+    static const QRegularExpression referenceLinkRegex(
+        QStringLiteral(R"(\[(.*?)\]\[(.+?)\])"));
+    iterator = referenceLinkRegex.globalMatch(text);
     while (iterator.hasNext()) {
         QRegularExpressionMatch match = iterator.next();
         QString linkText = match.captured(1);
         QString referenceId = match.captured(2);
+        QString url = referenceUrl(referenceId);
 
-        // search for the referenced url in the whole text edit
-        //        QRegularExpression refRegExp(
-        //                "\\[" + QRegularExpression::escape(referenceId) +
-        //                        "\\]: (.+?:\\/\\/.+)");
-        QRegularExpression refRegExp(QStringLiteral("\\[") +
-                                     QRegularExpression::escape(referenceId) +
-                                     QStringLiteral("\\]: (.+?)"));
-        QRegularExpressionMatch urlMatch = refRegExp.match(toPlainText());
-
-        if (urlMatch.hasMatch()) {
-            QString url = urlMatch.captured(1);
+        if (!url.isEmpty()) {
             urlMap[linkText] = url;
         }
     }
@@ -1207,6 +1268,45 @@ QMap<QString, QString> QMarkdownTextEdit::parseMarkdownUrlsFromText(
     return urlMap;
 }
 
+/**
+ * @brief Returns the url of the reference definition [referenceId]: url
+ *
+ * The highlighter indexes the definitions while highlighting, without it
+ * or while it didn't get to every block yet the blocks are searched.
+ *
+ * @param referenceId
+ * @return the url or an empty string if there is no definition
+ */
+QString QMarkdownTextEdit::referenceUrl(const QString &referenceId) const {
+    // the highlighter is only attached to the document of a shown editor,
+    // and its index misses the definitions in blocks that are still pending
+    // or in deferred cascades
+    if (_highlighter != nullptr && _highlighter->document() != nullptr &&
+        !_highlighter->hasPendingBlocks() &&
+        !_highlighter->hasDeferredCascades()) {
+        return _highlighter->referenceUrl(referenceId);
+    }
+
+    static const QRegularExpression referenceDefinitionRegex(
+        QStringLiteral(R"(^\[(.+?)\]: (\S+))"));
+
+    for (QTextBlock block = document()->firstBlock(); block.isValid();
+         block = block.next()) {
+        const QString text = block.text();
+        if (!text.startsWith(QLatin1Char('['))) {
+            continue;
+        }
+
+        const QRegularExpressionMatch match =
+            referenceDefinitionRegex.match(text);
+        if (match.hasMatch() && match.captured(1) == referenceId) {
+            return match.captured(2);
+        }
+    }
+
+    return QString();
+}
+
 /**
  * @brief Returns the markdown url at position
  * @param text
@@ -1286,12 +1386,370 @@ void QMarkdownTextEdit::duplicateText() {
 void QMarkdownTextEdit::setText(const QString &text) { setPlainText(text); }
 
 void QMarkdownTextEdit::setPlainText(const QString &text) {
+    cancelLoading();
+
     // clear the dirty blocks vector to increase performance and prevent
     // a possible crash in QSyntaxHighlighter::rehighlightBlock
-    _highlighter->clearDirtyBlocks();
+    if (_highlighter) {
+        _highlighter->clearDirtyBlocks();
+    }
 
     QPlainTextEdit::setPlainText(text);
     adjustRightMargin();
+    updateHighlighterVisibleBlocks();
+}
+
+/**
+ * Loads a UTF-8 text file in the background, see loadFromDevice()
+ *
+ * The file is memory mapped if possible, to save a copy of the text.
+ *
+ * @param fileName
+ * @return false if the file couldn't be opened
+ */
+bool QMarkdownTextEdit::loadFile(const QString &fileName) {
+    auto *file = new QFile(fileName, this);
+    if (!file->open(QIODevice::ReadOnly) || !loadFromDevice(file)) {
+        delete file;
+        return false;
+    }
+
+    _loadFile = file;
+    if (file->size() > 0) {
+        _loadMap = file->map(0, file->size());
+    }
+
+    return true;
+}
+
+/**
+ * Returns true if a sequential device won't produce any more data
+ *
+ * atEnd() can't tell, it is also true while nothing is buffered yet.
+ */
+static bool isSequentialDeviceFinished(QIODevice *device) {
+    if (!device->isOpen()) {
+        return true;
+    }
+
+    const auto *process = qobject_cast<QProcess *>(device);
+    return process != nullptr && process->state() == QProcess::NotRunning &&
+           process->bytesAvailable() == 0;
+}
+
+/**
+ * Replaces the text with the UTF-8 text of an open device, like
+ * setPlainText() but in batches between event loop iterations
+ *
+ * The text can be scrolled while it is loading, only the visible part gets
+ * highlighted right away. loadProgress() is emitted after every batch and
+ * loadFinished() at the end. Sequential devices are read until they emit
+ * readChannelFinished(), are closed or are a process that exited.
+ *
+ * @param device the device has to stay open until loadFinished()
+ * @return false if the device can't be read
+ */
+bool QMarkdownTextEdit::loadFromDevice(QIODevice *device) {
+    if (device == nullptr || !device->isReadable()) {
+        return false;
+    }
+
+    setPlainText(QString());
+
+    _loading = true;
+    _loadDevice = device;
+    _loadPosition = 0;
+    _loadSize = device->isSequential() ? -1 : device->size();
+    _loadReadChannelFinished = false;
+
+    // the undo stack would hold another copy of the text
+    document()->setUndoRedoEnabled(false);
+
+    // highlight the visible blocks first, the rest follows in idle time
+    if (_highlighter != nullptr && !_highlighter->lazyHighlighting()) {
+        _highlighter->setLazyHighlighting(true);
+        _loadRestoreLazyHighlighting = true;
+    }
+
+    if (device->isSequential()) {
+        connect(device, &QIODevice::readyRead, this,
+                &QMarkdownTextEdit::loadNextChunks);
+        connect(device, &QIODevice::readChannelFinished, this, [this] {
+            _loadReadChannelFinished = true;
+            loadNextChunks();
+        });
+
+        // readChannelFinished() may have been emitted before the connect
+        if (isSequentialDeviceFinished(device)) {
+            _loadReadChannelFinished = true;
+        }
+    }
+
+    if (_loadTimer == nullptr) {
+        _loadTimer = new QTimer(this);
+        _loadTimer->setSingleShot(true);
+        connect(_loadTimer, &QTimer::timeout, this,
+                &QMarkdownTextEdit::loadNextChunks);
+    }
+    _loadTimer->start(0);
+
+    return true;
+}
+
+/**
+ * Stops loading, the text that was loaded so far is kept
+ */
+void QMarkdownTextEdit::cancelLoading() {
+    if (_loading) {
+        finishLoading(false);
+    }
+}
+
+/**
+ * Appends chunks of the loaded device until the time budget is used up
+ */
+void QMarkdownTextEdit::loadNextChunks() {
+    if (!_loading) {
+        return;
+    }
+
+    if (_loadDevice.isNull()) {
+        finishLoading(false);
+        return;
+    }
+
+    QElapsedTimer elapsedTimer;
+    elapsedTimer.start();
+
+    const bool firstBatch = document()->isEmpty();
+    QTextCursor cursor(document());
+    cursor.movePosition(QTextCursor::End);
+    QByteArray chunk;
+
+    while (elapsedTimer.elapsed() < loadTimeBudget) {
+        if (_loadMap != nullptr) {
+            const qint64 length =
+                qMin<qint64>(loadChunkSize, _loadSize - _loadPosition);
+            if (length <= 0) {
+                finishLoading(true);
+                return;
+            }
+
+            appendLoadedData(
+                cursor, reinterpret_cast<const char *>(_loadMap) + _loadPosition,
+                static_cast<int>(length), false);
+            _loadPosition += length;
+            continue;
+        }
+
+        chunk.resize(loadChunkSize);
+        const qint64 length = _loadDevice->read(chunk.data(), loadChunkSize);
+        if (length < 0) {
+            finishLoading(false);
+            return;
+        }
+
+        if (length == 0) {
+            if (!_loadDevice->isSequential() || _loadReadChannelFinished ||
+                isSequentialDeviceFinished(_loadDevice)) {
+                finishLoading(true);
+                return;
+            }
+
+            // wait for readyRead()
+            break;
+        }
+
+        appendLoadedData(cursor, chunk.constData(), static_cast<int>(length),
+                         false);
+        _loadPosition += length;
+    }
+
+    // the text was inserted at the text cursor
+    if (firstBatch) {
+        moveCursor(QTextCursor::Start);
+    }
+
+    updateHighlighterVisibleBlocks();
+    emit loadProgress(_loadPosition, _loadSize);
+
+    // readyRead() won't come again for data that arrived during the batch
+    // and nothing at all after the end, the next batch then finishes
+    if (!_loadDevice->isSequential() || _loadDevice->bytesAvailable() > 0 ||
+        _loadReadChannelFinished || isSequentialDeviceFinished(_loadDevice)) {
+        _loadTimer->start(0);
+    }
+}
+
+/**
+ * Appends the complete lines of loaded data to the text, the rest is kept
+ * in _loadBuffer until the next chunk
+ *
+ * A line break is never part of a multi-byte UTF-8 sequence, so every line
+ * can be decoded on its own.
+ *
+ * @param cursor the cursor at the end of the text
+ * @param data
+ * @param length
+ * @param atEnd true if there is no more data
+ */
+void QMarkdownTextEdit::appendLoadedData(QTextCursor &cursor, const char *data,
+                                         int length, bool atEnd) {
+    int end = length;
+    if (!atEnd) {
+        while (end > 0 && data[end - 1] != '\n') {
+            --end;
+        }
+    }
+
+    QString text;
+    if (end > 0 || atEnd) {
+        if (_loadBuffer.isEmpty()) {
+            text = QString::fromUtf8(data, end);
+        } else {
+            _loadBuffer.append(data, end);
+            text = QString::fromUtf8(_loadBuffer);
+        }
+        _loadBuffer = QByteArray(data + end, length - end);
+    } else {
+        _loadBuffer.append(data, length);
+        if (_loadBuffer.size() < loadChunkSize) {
+            return;
+        }
+
+        // very long lines are appended up to their last complete character
+        end = _loadBuffer.size();
+        while (end > 0 &&
+               (static_cast<uchar>(_loadBuffer.at(end - 1)) & 0xC0) == 0x80) {
+            --end;
+        }
+        if (end > 0 && static_cast<uchar>(_loadBuffer.at(end - 1)) >= 0xC0) {
+            --end;
+        }
+        // don't split a \r\n line break
+        if (end > 0 && _loadBuffer.at(end - 1) == '\r') {
+            --end;
+        }
+
+        text = QString::fromUtf8(_loadBuffer.constData(), end);
+        _loadBuffer.remove(0, end);
+    }
+
+    if (cursor.position() == 0 && text.startsWith(QChar(0xFEFF))) {
+        text.remove(0, 1);
+    }
+    if (text.contains(QLatin1Char('\r'))) {
+        text.replace(QStringLiteral("\r\n"), QStringLiteral("\n"));
+    }
+
+    cursor.insertText(text);
+}
+
+/**
+ * Ends loading, the rest of the loaded data is appended if it succeeded
+ *
+ * @param success
+ */
+void QMarkdownTextEdit::finishLoading(bool success) {
+    _loading = false;
+    _loadTimer->stop();
+
+    if (success && !_loadBuffer.isEmpty()) {
+        QTextCursor cursor(document());
+        cursor.movePosition(QTextCursor::End);
+        appendLoadedData(cursor, nullptr, 0, true);
+    }
+    _loadBuffer.clear();
+
+    if (!_loadDevice.isNull()) {
+        disconnect(_loadDevice.data(), nullptr, this, nullptr);
+    }
+    _loadDevice = nullptr;
+
+    if (_loadFile != nullptr) {
+        if (_loadMap != nullptr) {
+            _loadFile->unmap(const_cast<uchar *>(_loadMap));
+            _loadMap = nullptr;
+        }
+        _loadFile->deleteLater();
+        _loadFile = nullptr;
+    }
+
+    document()->setUndoRedoEnabled(true);
+    document()->setModified(false);
+
+    // switch back once the background highlighting is done, switching back
+    // right away would highlight the whole text at once
+    if (_loadRestoreLazyHighlighting && _highlighter != nullptr) {
+        connect(_highlighter, &MarkdownHighlighter::highlightingFinished,
+                this, &QMarkdownTextEdit::restoreLazyHighlighting,
+                Qt::UniqueConnection);
+        restoreLazyHighlighting();
+    }
+
+    adjustRightMargin();
+    updateHighlighterVisibleBlocks();
+    emit loadProgress(_loadPosition, _loadSize);
+    emit loadFinished(success);
+}
+
+/**
+ * Turns lazy highlighting off again after loading, once no blocks are
+ * pending anymore
+ */
+void QMarkdownTextEdit::restoreLazyHighlighting() {
+    if (!_loadRestoreLazyHighlighting || _highlighter == nullptr) {
+        return;
+    }
+
+    // a hidden editor didn't highlight anything yet
+    if (_loading || _highlighter->document() == nullptr ||
+        _highlighter->hasPendingBlocks()) {
+        return;
+    }
+
+    _loadRestoreLazyHighlighting = false;
+    disconnect(_highlighter, &MarkdownHighlighter::highlightingFinished, this,
+               &QMarkdownTextEdit::restoreLazyHighlighting);
+    _highlighter->setLazyHighlighting(false);
+}
+
+/**
+ * Enables lazy highlighting for very large documents, only the visible part
+ * of the text will be highlighted right away
+ *
+ * @param enabled
+ */
+void QMarkdownTextEdit::setLazyHighlighting(bool enabled) {
+    if (_highlighter == nullptr) {
+        return;
+    }
+
+    _highlighter->setLazyHighlighting(enabled);
+    updateHighlighterVisibleBlocks();
+}
+
+/**
+ * Reports the blocks in the viewport to the highlighter
+ */
+void QMarkdownTextEdit::updateHighlighterVisibleBlocks() {
+    if (_highlighter == nullptr) {
+        return;
+    }
+
+    QTextBlock block = firstVisibleBlock();
+    const int firstBlockNumber = block.blockNumber();
+    int lastBlockNumber = firstBlockNumber;
+    const qreal viewportHeight = viewport()->rect().height();
+    qreal top = blockBoundingGeometry(block).translated(contentOffset()).top();
+
+    while (block.isValid() && top <= viewportHeight) {
+        lastBlockNumber = block.blockNumber();
+        top += blockBoundingRect(block).height();
+        block = block.next();
+    }
+
+    _highlighter->setVisibleBlockRange(firstBlockNumber, lastBlockNumber);
 }
 
 /**
@@ -1299,9 +1757,7 @@ void QMarkdownTextEdit::setPlainText(const QString &text) {
  */
 void QMarkdownTextEdit::initSearchFrame(QWidget *searchFrame, bool darkMode) {
     _searchFrame = searchFrame;
-
-    // remove the search widget from our layout
-    layout()->removeWidget(_searchWidget);
+    _searchFrameDarkMode = darkMode;
 
     QLayout *layout = _searchFrame->layout();
 
@@ -1310,18 +1766,28 @@ void QMarkdownTextEdit::initSearchFrame(QWidget *searchFrame, bool darkMode) {
         layout = new QVBoxLayout(_searchFrame);
         layout->setSpacing(0);
         layout->setContentsMargins(0, 0, 0, 0);
+        _searchFrame->setLayout(layout);
     }
 
+    // the search widget is added to the frame when it gets created
+    if (_searchWidget == nullptr) {
+        return;
+    }
+
+    // remove the search widget from our layout
+    this->layout()->removeWidget(_searchWidget);
+
     _searchWidget->setDarkMode(darkMode);
     layout->addWidget(_searchWidget);
-    _searchFrame->setLayout(layout);
 }
 
 /**
  * Hides the text edit and the search widget
  */
 void QMarkdownTextEdit::hide() {
-    _searchWidget->hide();
+    if (_searchWidget != nullptr) {
+        _searchWidget->hide();
+    }
     QWidget::hide();
 }
 
@@ -1339,89 +1805,59 @@ bool QMarkdownTextEdit::handleReturnEntered() {
     cursor.movePosition(QTextCursor::StartOfBlock, QTextCursor::KeepAnchor);
     const QString currentLineText = cursor.selectedText();
 
-    // if return is pressed and there is just an unordered list symbol then we
-    // want to remove the list symbol Valid listCharacters: '+ ', '-' , '* ', '+
-    // [ ] ', '+ [x] ', '- [ ] ', '- [x] ', '* [ ] ', '* [x] '.
-    QRegularExpression regex(R"(^(\s*)([+|\-|\*] \[(x| |)\]|[+\-\*])(\s+)$)");
-    QRegularExpressionMatchIterator iterator =
-        regex.globalMatch(currentLineText);
-    if (iterator.hasNext()) {
-        cursor.removeSelectedText();
-        return true;
-    }
+    MarkdownHighlighter::ListPrefix prefix;
+    const bool isListItem =
+        MarkdownHighlighter::parseListPrefix(currentLineText, prefix);
 
-    // if return is pressed and there is just an ordered list symbol then we
-    // want to remove the list symbol
-    regex = QRegularExpression(R"(^(\s*)(\d+[\.|\)])(\s+)$)");
-    iterator = regex.globalMatch(currentLineText);
-    if (iterator.hasNext()) {
-        qDebug() << cursor.selectedText();
+    // if return is pressed and there is just a list symbol then we want to
+    // remove the list symbol
+    // Valid listCharacters: '+ ', '-' , '* ', '+ [ ] ', '+ [x] ', '- [ ] ',
+    // '- [x] ', '* [ ] ', '* [x] ', '1. ', '1) '.
+    if (isListItem && prefix.length() == currentLineText.length()) {
         cursor.removeSelectedText();
         return true;
     }
 
+    const QString whitespaces = currentLineText.left(prefix.indent);
+    const QString whitespaceCharacter = currentLineText.mid(
+        prefix.indent + prefix.markerLength, prefix.spacing);
+
     // Check if we are in an unordered list.
     // We are in a list when we have '* ', '- ' or '+ ', possibly with preceding
     // whitespace. If e.g. user has entered '**text**' and pressed enter - we
     // don't want do anymore list-stuff.
-    QString currentLine = currentLineText.trimmed();
-    QChar char0;
-    QChar char1;
-    if (currentLine.length() >= 1)
-        char0 = currentLine.at(0);
-    if (currentLine.length() >= 2)
-        char1 = currentLine.at(1);
-    const bool inList =
-        ((char0 == QLatin1Char('*') || char0 == QLatin1Char('-') ||
-          char0 == QLatin1Char('+')) &&
-         char1 == QLatin1Char(' '));
-
-    if (inList) {
+    if (isListItem && !prefix.isOrdered() &&
+        currentLineText.at(prefix.indent + 1) == QLatin1Char(' ')) {
         // if the current line starts with a list character (possibly after
         // whitespaces) add the whitespaces at the next line too
-        // Valid listCharacters: '+ ', '-' , '* ', '+ [ ] ', '+ [x] ', '- [ ] ',
-        // '- [x] ', '* [ ] ', '* [x] '.
-        regex =
-            QRegularExpression(R"(^(\s*)([+|\-|\*] \[(x| |)\]|[+\-\*])(\s+))");
-        iterator = regex.globalMatch(currentLineText);
-        if (iterator.hasNext()) {
-            const QRegularExpressionMatch match = iterator.next();
-            const QString whitespaces = match.captured(1);
-            QString listCharacter = match.captured(2);
-            const QString whitespaceCharacter = match.captured(4);
-
-            // start new checkbox list item with an unchecked checkbox
-            iterator = QRegularExpression(R"(^([+|\-|\*]) \[(x| |)\])")
-                           .globalMatch(listCharacter);
-            if (iterator.hasNext()) {
-                const QRegularExpressionMatch match = iterator.next();
-                const QString realListCharacter = match.captured(1);
-                listCharacter = realListCharacter + QStringLiteral(" [ ]");
-            }
+        QString listCharacter = currentLineText.mid(prefix.indent, 1);
 
-            cursor.setPosition(position);
-            cursor.insertText("\n" + whitespaces + listCharacter +
-                              whitespaceCharacter);
-
-            // scroll to the cursor if we are at the bottom of the document
-            ensureCursorVisible();
-            return true;
+        // start new checkbox list item with an unchecked checkbox
+        if (prefix.hasCheckBoxMarker()) {
+            listCharacter += QStringLiteral(" [ ]");
         }
+
+        cursor.setPosition(position);
+        cursor.insertText(QStringLiteral("\n") + whitespaces + listCharacter +
+                          whitespaceCharacter);
+
+        // scroll to the cursor if we are at the bottom of the document
+        ensureCursorVisible();
+        return true;
     }
 
     // check for ordered lists and increment the list number in the next line
-    regex = QRegularExpression(R"(^(\s*)(\d+)([\.|\)])(\s+))");
-    iterator = regex.globalMatch(currentLineText);
-    if (iterator.hasNext()) {
-        const QRegularExpressionMatch match = iterator.next();
-        const QString whitespaces = match.captured(1);
-        const uint listNumber = match.captured(2).toUInt();
-        const QString listMarker = match.captured(3);
-        const QString whitespaceCharacter = match.captured(4);
+    if (isListItem && prefix.isOrdered()) {
+        const uint listNumber =
+            currentLineText.midRef(prefix.indent, prefix.numberLength)
+                .toUInt();
+        const QChar listMarker =
+            currentLineText.at(prefix.indent + prefix.numberLength);
 
         cursor.setPosition(position);
-        cursor.insertText("\n" + whitespaces + QString::number(listNumber + 1) +
-                          listMarker + whitespaceCharacter);
+        cursor.insertText(QStringLiteral("\n") + whitespaces +
+                          QString::number(listNumber + 1) + listMarker +
+                          whitespaceCharacter);
 
         // scroll to the cursor if we are at the bottom of the document
         ensureCursorVisible();
@@ -1429,14 +1865,9 @@ bool QMarkdownTextEdit::handleReturnEntered() {
     }
 
     // intent next line with same whitespaces as in current line
-    regex = QRegularExpression(R"(^(\s+))");
-    iterator = regex.globalMatch(currentLineText);
-    if (iterator.hasNext()) {
-        const QRegularExpressionMatch match = iterator.next();
-        const QString whitespaces = match.captured(1);
-
+    if (prefix.indent > 0) {
         cursor.setPosition(position);
-        cursor.insertText("\n" + whitespaces);
+        cursor.insertText(QStringLiteral("\n") + whitespaces);
 
         // scroll to the cursor if we are at the bottom of the document
         ensureCursorVisible();
@@ -1462,55 +1893,29 @@ bool QMarkdownTextEdit::handleTabEntered(bool reverse,
         cursor.movePosition(QTextCursor::StartOfBlock, QTextCursor::KeepAnchor);
         const QString currentLineText = cursor.selectedText();
 
-        // check if we want to indent or un-indent an ordered list
+        // check if we want to indent or un-indent an empty list item
         // Valid listCharacters: '+ ', '-' , '* ', '+ [ ] ', '+ [x] ', '- [ ] ',
-        // '- [x] ', '* [ ] ', '* [x] '.
-        QRegularExpression re(R"(^(\s*)([+|\-|\*] \[(x| )\]|[+\-\*])(\s+)$)");
-        QRegularExpressionMatchIterator i = re.globalMatch(currentLineText);
-
-        if (i.hasNext()) {
-            QRegularExpressionMatch match = i.next();
-            QString whitespaces = match.captured(1);
-            const QString listCharacter = match.captured(2);
-            const QString whitespaceCharacter = match.captured(4);
+        // '- [x] ', '* [ ] ', '* [x] ', '1. ', '1) '.
+        MarkdownHighlighter::ListPrefix prefix;
+        if (MarkdownHighlighter::parseListPrefix(currentLineText, prefix) &&
+            prefix.length() == currentLineText.length()) {
+            QString whitespaces = currentLineText.left(prefix.indent);
 
             // add or remove one tabulator key
-            if (reverse) {
-                // remove one set of indentCharacters or a tabulator
-                whitespaces.remove(QRegularExpression(
-                    QStringLiteral("^(\\t|") +
-                    QRegularExpression::escape(indentCharacters) +
-                    QStringLiteral(")")));
-
-            } else {
+            if (!reverse) {
                 whitespaces += indentCharacters;
-            }
-
-            cursor.insertText(whitespaces + listCharacter +
-                              whitespaceCharacter);
-            return true;
-        }
-
-        // check if we want to indent or un-indent an ordered list
-        re = QRegularExpression(R"(^(\s*)(\d+)([\.|\)])(\s+)$)");
-        i = re.globalMatch(currentLineText);
-
-        if (i.hasNext()) {
-            const QRegularExpressionMatch match = i.next();
-            QString whitespaces = match.captured(1);
-            const QString listCharacter = match.captured(2);
-            const QString listMarker = match.captured(3);
-            const QString whitespaceCharacter = match.captured(4);
-
-            // add or remove one tabulator key
-            if (reverse) {
+            } else if (prefix.isOrdered()) {
                 whitespaces.chop(1);
-            } else {
-                whitespaces += indentCharacters;
+            } else if (whitespaces.startsWith(QLatin1Char('\t'))) {
+                whitespaces.remove(0, 1);
+            } else if (!indentCharacters.isEmpty() &&
+                       whitespaces.startsWith(indentCharacters)) {
+                // remove one set of indentCharacters
+                whitespaces.remove(0, indentCharacters.length());
             }
 
-            cursor.insertText(whitespaces + listCharacter + listMarker +
-                              whitespaceCharacter);
+            cursor.insertText(whitespaces +
+                              currentLineText.mid(prefix.indent));
             return true;
         }
     }
@@ -1526,6 +1931,44 @@ void QMarkdownTextEdit::setAutoTextOptions(AutoTextOptions options) {
     _autoTextOptions = options;
 }
 
+/**
+ * Defers the highlighting until the editor is shown for the first time, so
+ * opening many editors in tabs only highlights the visible one
+ *
+ * Until then the highlighter has no document, so it has no outline, block
+ * ranges or reference definitions either. Off by default.
+ *
+ * @param enabled
+ */
+void QMarkdownTextEdit::setDeferHighlightingUntilShown(bool enabled) {
+    _deferHighlightingUntilShown = enabled;
+
+    if (_highlighter == nullptr || !_highlightingEnabled || _shown) {
+        return;
+    }
+
+    _highlighter->setDocument(enabled ? Q_NULLPTR : document());
+}
+
+/**
+ * Attaches a deferred highlighter to the document when the editor is shown
+ * for the first time
+ */
+void QMarkdownTextEdit::showEvent(QShowEvent *event) {
+    QPlainTextEdit::showEvent(event);
+
+    if (_shown) {
+        return;
+    }
+    _shown = true;
+
+    if (_highlighter != nullptr && _highlightingEnabled &&
+        _highlighter->document() == nullptr) {
+        _highlighter->setDocument(document());
+        updateHighlighterVisibleBlocks();
+    }
+}
+
 /**
  * @param e
  * @details This does two things
@@ -1535,118 +1978,39 @@ void QMarkdownTextEdit::setAutoTextOptions(AutoTextOptions options) {
  * modifications and minor improvements for our use
  */
 void QMarkdownTextEdit::paintEvent(QPaintEvent *e) {
+    if (_highlighter != _codeBlocksHighlighter) {
+        if (_codeBlocksHighlighter) {
+            disconnect(_codeBlocksHighlighter.data(),
+                       &MarkdownHighlighter::codeBlocksChanged, this,
+                       &QMarkdownTextEdit::updateCodeBlocks);
+        }
+        _codeBlocksHighlighter = _highlighter;
+        if (_highlighter != nullptr) {
+            connect(_highlighter, &MarkdownHighlighter::codeBlocksChanged,
+                    this, &QMarkdownTextEdit::updateCodeBlocks);
+        }
+    }
+
     QTextBlock block = firstVisibleBlock();
 
     QPainter painter(viewport());
     const QRect viewportRect = viewport()->rect();
+    const QRect exposedRect = e->rect();
     // painter.fillRect(viewportRect, Qt::transparent);
-    bool firstVisible = true;
     QPointF offset(contentOffset());
-    QRectF blockAreaRect;    // Code or block quote rect.
-    bool inBlockArea = false;
 
-    bool clipTop = false;
-    bool drawBlock = false;
-    qreal dy = 0.0;
-    bool done = false;
+    // the geometry of the visible blocks, starting at the first one
+    QVector<QRectF> blockRects;
 
-    const QColor &color = MarkdownHighlighter::codeBlockBackgroundColor();
-    const int cornerRadius = 5;
-
-    while (block.isValid() && !done) {
+    while (block.isValid() && offset.y() <= viewportRect.height()) {
         const QRectF r = blockBoundingRect(block).translated(offset);
-        const int state = block.userState();
-
-        if (!inBlockArea && MarkdownHighlighter::isCodeBlock(state)) {
-            // skip the backticks
-            if (!block.text().startsWith(QLatin1String("```")) &&
-                !block.text().startsWith(QLatin1String("~~~"))) {
-                blockAreaRect = r;
-                dy = 0.0;
-                inBlockArea = true;
-            }
-
-            // If this is the first visible block within the viewport
-            // and if the previous block is part of the text block area,
-            // then the rectangle to draw for the block area will have
-            // its top clipped by the viewport and will need to be
-            // drawn specially.
-            const int prevBlockState = block.previous().userState();
-            if (firstVisible &&
-                MarkdownHighlighter::isCodeBlock(prevBlockState)) {
-                clipTop = true;
-            }
-        }
-        // Else if the block ends a text block area...
-        else if (inBlockArea && MarkdownHighlighter::isCodeBlockEnd(state)) {
-            drawBlock = true;
-            inBlockArea = false;
-            blockAreaRect.setHeight(dy);
-        }
-        // If the block is at the end of the document and ends a text
-        // block area...
-        //
-        if (inBlockArea && block == this->document()->lastBlock()) {
-            drawBlock = true;
-            inBlockArea = false;
-            dy += r.height();
-            blockAreaRect.setHeight(dy);
-        }
-        offset.ry() += r.height();
-        dy += r.height();
-
-        // If this is the last text block visible within the viewport...
-        if (offset.y() > viewportRect.height()) {
-            if (inBlockArea) {
-                blockAreaRect.setHeight(dy);
-                drawBlock = true;
-            }
-
-            // Finished drawing.
-            done = true;
-        }
-        // If this is the last text block visible within the viewport...
-        if (offset.y() > viewportRect.height()) {
-            if (inBlockArea) {
-                blockAreaRect.setHeight(dy);
-                drawBlock = true;
-            }
-            // Finished drawing.
-            done = true;
-        }
-
-        if (drawBlock) {
-            painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-            painter.setPen(Qt::NoPen);
-            painter.setBrush(QBrush(color));
-
-            // If the first visible block is "clipped" such that the previous
-            // block is part of the text block area, then only draw a rectangle
-            // with the bottom corners rounded, and with the top corners square
-            // to reflect that the first visible block is part of a larger block
-            // of text.
-            //
-            if (clipTop) {
-                QPainterPath path;
-                path.setFillRule(Qt::WindingFill);
-                path.addRoundedRect(blockAreaRect, cornerRadius, cornerRadius);
-                qreal adjustedHeight = blockAreaRect.height() / 2;
-                path.addRect(blockAreaRect.adjusted(0, 0, 0, -adjustedHeight));
-                painter.drawPath(path.simplified());
-                clipTop = false;
-            }
-            // Else draw the entire rectangle with all corners rounded.
-            else {
-                painter.drawRoundedRect(blockAreaRect, cornerRadius,
-                                        cornerRadius);
-            }
-
-            drawBlock = false;
-        }
+        blockRects.append(r);
 
         // this fixes the RTL bug of QPlainTextEdit
         // https://bugreports.qt.io/browse/QTBUG-7516
-        if (block.text().isRightToLeft()) {
+        if (r.bottom() >= exposedRect.top() &&
+            r.top() <= exposedRect.bottom() &&
+            block.text().isRightToLeft()) {
             QTextLayout *layout = block.layout();
             // opt = document()->defaultTextOption();
             QTextOption opt = QTextOption(Qt::AlignRight);
@@ -1654,14 +2018,98 @@ void QMarkdownTextEdit::paintEvent(QPaintEvent *e) {
             layout->setTextOption(opt);
         }
 
+        offset.ry() += r.height();
         block = block.next();
-        firstVisible = false;
+    }
+
+    // without a highlighter the blocks have no code block states
+    if (_highlighter != nullptr && !blockRects.isEmpty()) {
+        paintCodeBlockBackgrounds(painter, blockRects, exposedRect);
     }
 
     painter.end();
     QPlainTextEdit::paintEvent(e);
 }
 
+/**
+ * @brief Paints the backgrounds of the code blocks in the visible blocks
+ *
+ * A code block starts after its opening fence and ends before the closing
+ * one, or with the document. Only the visible blocks and the one before
+ * them are looked at, the block states tell if a code block started above.
+ *
+ * @param blockRects the geometry of the visible blocks
+ */
+void QMarkdownTextEdit::paintCodeBlockBackgrounds(
+    QPainter &painter, const QVector<QRectF> &blockRects,
+    const QRect &exposedRect) {
+    const QColor &color = MarkdownHighlighter::codeBlockBackgroundColor();
+    const int cornerRadius = 5;
+
+    painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QBrush(color));
+
+    auto paintSpan = [&](int first, int end, bool startsAbove) {
+        QRectF blockAreaRect = blockRects.at(first);
+        blockAreaRect.setBottom(blockRects.at(end - 1).bottom());
+
+        // only paint what needs to be repainted
+        if (!blockAreaRect.intersects(exposedRect)) {
+            return;
+        }
+
+        // If the code block starts above the viewport, then only draw a
+        // rectangle with the bottom corners rounded, and with the top
+        // corners square to reflect that the first visible block is part
+        // of a larger block of text.
+        //
+        if (startsAbove) {
+            QPainterPath path;
+            path.setFillRule(Qt::WindingFill);
+            path.addRoundedRect(blockAreaRect, cornerRadius, cornerRadius);
+            qreal adjustedHeight = blockAreaRect.height() / 2;
+            path.addRect(blockAreaRect.adjusted(0, 0, 0, -adjustedHeight));
+            painter.drawPath(path.simplified());
+        }
+        // Else draw the entire rectangle with all corners rounded.
+        else {
+            painter.drawRoundedRect(blockAreaRect, cornerRadius, cornerRadius);
+        }
+    };
+
+    QTextBlock block = firstVisibleBlock();
+    const bool openAbove = MarkdownHighlighter::codeBlockKind(
+                               block.previous()) ==
+                           MarkdownHighlighter::CodeBlockKind::Content;
+    // the index of the first visible block of the open code block
+    int first = -1;
+
+    for (int i = 0; i < blockRects.size(); ++i, block = block.next()) {
+        const MarkdownHighlighter::CodeBlockKind kind =
+            MarkdownHighlighter::codeBlockKind(block);
+
+        if (first == -1) {
+            if (kind == MarkdownHighlighter::CodeBlockKind::Content) {
+                first = i;
+            }
+        } else if (kind == MarkdownHighlighter::CodeBlockKind::End) {
+            paintSpan(first, i, first == 0 && openAbove);
+            first = -1;
+        }
+    }
+
+    if (first != -1) {
+        paintSpan(first, blockRects.size(), first == 0 && openAbove);
+    }
+}
+
+/**
+ * Repaints the code block backgrounds after the highlighter changed the
+ * code block states
+ */
+void QMarkdownTextEdit::updateCodeBlocks() { viewport()->update(); }
+
 /**
  * Overrides QPlainTextEdit::setReadOnly to fix a problem with Chinese and
  * Japanese input methods
@@ -1678,13 +2126,18 @@ void QMarkdownTextEdit::setReadOnly(bool ro) {
 
 void QMarkdownTextEdit::doSearch(
     QString &searchText, QPlainTextEditSearchWidget::SearchMode searchMode) {
-    _searchWidget->setSearchText(searchText);
-    _searchWidget->setSearchMode(searchMode);
-    _searchWidget->doSearchCount();
-    _searchWidget->activate(false);
+    QPlainTextEditSearchWidget *widget = searchWidget();
+    widget->setSearchText(searchText);
+    widget->setSearchMode(searchMode);
+    widget->doSearchCount();
+    widget->activate(false);
 }
 
 void QMarkdownTextEdit::hideSearchWidget(bool reset) {
+    if (_searchWidget == nullptr) {
+        return;
+    }
+
     _searchWidget->deactivate();
 
     if (reset) {
@@ -16,10 +16,16 @@
 
 #include <QEvent>
 #include <QPlainTextEdit>
+#include <QPointer>
 
 #include "qplaintexteditsearchwidget.h"
 #include "markdownhighlighter.h"
 
+class QFile;
+class QIODevice;
+class QPainter;
+class QTimer;
+
 class QMarkdownTextEdit : public QPlainTextEdit {
     Q_OBJECT
 
@@ -46,6 +52,8 @@ class QMarkdownTextEdit : public QPlainTextEdit {
     void initSearchFrame(QWidget *searchFrame, bool darkMode = false);
     void setAutoTextOptions(AutoTextOptions options);
     void setHighlightingEnabled(bool enabled);
+    void setLazyHighlighting(bool enabled);
+    void setDeferHighlightingUntilShown(bool enabled);
     static bool isValidUrl(const QString &urlString);
     void resetMouseCursor() const;
     void setReadOnly(bool ro);
@@ -54,6 +62,9 @@ class QMarkdownTextEdit : public QPlainTextEdit {
                       QPlainTextEditSearchWidget::SearchMode::PlainTextMode);
     void hideSearchWidget(bool reset);
     void updateSettings();
+    bool loadFile(const QString &fileName);
+    bool loadFromDevice(QIODevice *device);
+    bool isLoading() const { return _loading; }
 
    public slots:
     void duplicateText();
@@ -66,16 +77,18 @@ class QMarkdownTextEdit : public QPlainTextEdit {
     void centerTheCursor();
     void undo();
     void moveTextUpDown(bool up);
+    void cancelLoading();
 
    protected:
     MarkdownHighlighter *_highlighter;
     bool _highlightingEnabled;
     QStringList _ignoredClickUrlSchemata;
-    QPlainTextEditSearchWidget *_searchWidget;
-    QWidget *_searchFrame;
     AutoTextOptions _autoTextOptions;
     bool _mouseButtonDown = false;
     bool _centerCursor = false;
+    // see setDeferHighlightingUntilShown()
+    bool _deferHighlightingUntilShown = false;
+    bool _shown = false;
 
     bool eventFilter(QObject *obj, QEvent *event);
     bool increaseSelectedTextIndention(
@@ -83,6 +96,7 @@ class QMarkdownTextEdit : public QPlainTextEdit {
     bool handleTabEntered(bool reverse,
                           const QString &indentCharacters = QChar('\t'));
     QMap<QString, QString> parseMarkdownUrlsFromText(const QString &text);
+    QString referenceUrl(const QString &referenceId) const;
     bool handleReturnEntered();
     bool handleBracketClosing(const QChar openingCharacter,
                               QChar closingCharacter = QChar());
@@ -91,13 +105,50 @@ class QMarkdownTextEdit : public QPlainTextEdit {
     bool quotationMarkCheck(const QChar quotationCharacter);
     void focusOutEvent(QFocusEvent *event);
     void paintEvent(QPaintEvent *e);
+    void showEvent(QShowEvent *event);
+    void updateHighlighterVisibleBlocks();
+    void paintCodeBlockBackgrounds(QPainter &painter,
+                                   const QVector<QRectF> &blockRects,
+                                   const QRect &exposedRect);
+    void updateCodeBlocks();
     bool handleCharRemoval(MarkdownHighlighter::RangeType type, int block, int position);
+    void loadNextChunks();
+    void appendLoadedData(QTextCursor &cursor, const char *data, int length,
+                          bool atEnd);
+    void finishLoading(bool success);
 
    signals:
     void urlClicked(QString url);
     void zoomIn();
     void zoomOut();
+    // bytesTotal is -1 if the size of the device isn't known
+    void loadProgress(qint64 bytesLoaded, qint64 bytesTotal);
+    void loadFinished(bool success);
 
    private:
+    void restoreLazyHighlighting();
+
+    // created by searchWidget() when it is needed first, subclasses have to
+    // use searchWidget()
+    QPlainTextEditSearchWidget *_searchWidget = nullptr;
+    QWidget *_searchFrame = nullptr;
+    bool _searchFrameDarkMode = false;
+
     bool _handleBracketClosingUsed;
+    // the highlighter whose codeBlocksChanged() repaints the code blocks
+    QPointer<MarkdownHighlighter> _codeBlocksHighlighter;
+    bool _loading = false;
+    // the device loadFromDevice() reads from
+    QPointer<QIODevice> _loadDevice;
+    // the file opened by loadFile(), owned by the editor
+    QFile *_loadFile = nullptr;
+    // the memory map of _loadFile, if it could be mapped
+    const uchar *_loadMap = nullptr;
+    QTimer *_loadTimer = nullptr;
+    qint64 _loadPosition = 0;
+    qint64 _loadSize = -1;
+    // the bytes after the last complete line that was loaded
+    QByteArray _loadBuffer;
+    bool _loadReadChannelFinished = false;
+    bool _loadRestoreLazyHighlighting = false;
 };
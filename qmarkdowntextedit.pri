@@ -1,4 +1,10 @@
 INCLUDEPATH += $$PWD/
 
+# the highlighter and its build options, the files below list its sources
+# again for projects that include them on their own
+include($$PWD/qmarkdownhighlighter.pri)
 include($$PWD/qmarkdowntextedit-headers.pri)
 include($$PWD/qmarkdowntextedit-sources.pri)
+
+HEADERS = $$unique(HEADERS)
+SOURCES = $$unique(SOURCES)
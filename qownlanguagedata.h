@@ -14,206 +14,69 @@
 #ifndef QOWNLANGUAGEDATA_H
 #define QOWNLANGUAGEDATA_H
 
-#include <QMultiHash>
-
-/* ------------------------
- * TEMPLATE FOR LANG DATA
- * -------------------------
- *
- * loadXXXData, where XXX is the language
- * keywords are the language keywords e.g, const
- * types are built-in types i.e, int, char, var
- * literals are words like, true false
- * builtin are the library functions
- * other can contain any other thing, for e.g, in cpp it contains the
- preprocessor
-
-    static const QMultiHash<char, QLatin1String> xxx_keywords = {
-    };
-
-    static const QMultiHash<char, QLatin1String> xxx_types = {
-    };
-
-    static const QMultiHash<char, QLatin1String> xxx_literals = {
-    };
-
-    static const QMultiHash<char, QLatin1String> xxx_builtin = {
-    };
-
-    static const QMultiHash<char, QLatin1String> xxx_other = {
+#include <QLatin1String>
+#include <cstddef>
+
+/**
+ * @brief A read-only index over the words of one category of a language
+ * @details The index is a view on a constant table that is sorted by the
+ * first character of the words, so the candidates for a position are found
+ * with a binary search. There is no initialization at runtime, lookups never
+ * allocate and the tables can be used from any thread.
+ */
+class LanguageKeywords {
+   public:
+    struct Range {
+        const QLatin1String *first;
+        const QLatin1String *last;
+        const QLatin1String *begin() const { return first; }
+        const QLatin1String *end() const { return last; }
     };
 
-*/
-
-/**********************************************************/
-/* C/C++ Data *********************************************/
-/**********************************************************/
-void loadCppData(QMultiHash<char, QLatin1String> &typess,
-                 QMultiHash<char, QLatin1String> &keywordss,
-                 QMultiHash<char, QLatin1String> &builtins,
-                 QMultiHash<char, QLatin1String> &literalss,
-                 QMultiHash<char, QLatin1String> &others);
-
-/**********************************************************/
-/* Shell Data *********************************************/
-/**********************************************************/
-void loadShellData(QMultiHash<char, QLatin1String> &types,
-                   QMultiHash<char, QLatin1String> &keywords,
-                   QMultiHash<char, QLatin1String> &builtin,
-                   QMultiHash<char, QLatin1String> &literals,
-                   QMultiHash<char, QLatin1String> &other);
-
-/**********************************************************/
-/* JS Data *********************************************/
-/**********************************************************/
-void loadJSData(QMultiHash<char, QLatin1String> &types,
-                QMultiHash<char, QLatin1String> &keywords,
-                QMultiHash<char, QLatin1String> &builtin,
-                QMultiHash<char, QLatin1String> &literals,
-                QMultiHash<char, QLatin1String> &other);
+    constexpr LanguageKeywords() : _words(nullptr), _count(0) {}
+    template <std::size_t N>
+    constexpr explicit LanguageKeywords(const QLatin1String (&words)[N])
+        : _words(words), _count(N) {}
 
-/**********************************************************/
-/* PHP Data *********************************************/
-/**********************************************************/
-void loadPHPData(QMultiHash<char, QLatin1String> &types,
-                 QMultiHash<char, QLatin1String> &keywords,
-                 QMultiHash<char, QLatin1String> &builtin,
-                 QMultiHash<char, QLatin1String> &literals,
-                 QMultiHash<char, QLatin1String> &other);
+    Range wordsStartingWith(char c) const;
 
-/**********************************************************/
-/* QML Data *********************************************/
-/**********************************************************/
-void loadQMLData(QMultiHash<char, QLatin1String> &types,
-                 QMultiHash<char, QLatin1String> &keywords,
-                 QMultiHash<char, QLatin1String> &builtin,
-                 QMultiHash<char, QLatin1String> &literals,
-                 QMultiHash<char, QLatin1String> &other);
+   private:
+    const QLatin1String *_words;
+    std::size_t _count;
+};
 
-/**********************************************************/
-/* Python Data *********************************************/
-/**********************************************************/
-void loadPythonData(QMultiHash<char, QLatin1String> &types,
-                    QMultiHash<char, QLatin1String> &keywords,
-                    QMultiHash<char, QLatin1String> &builtin,
-                    QMultiHash<char, QLatin1String> &literals,
-                    QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   Rust DATA      ***********************************/
-/********************************************************/
-void loadRustData(QMultiHash<char, QLatin1String> &types,
-                  QMultiHash<char, QLatin1String> &keywords,
-                  QMultiHash<char, QLatin1String> &builtin,
-                  QMultiHash<char, QLatin1String> &literals,
-                  QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   Java DATA      ***********************************/
-/********************************************************/
-void loadJavaData(QMultiHash<char, QLatin1String> &types,
-                  QMultiHash<char, QLatin1String> &keywords,
-                  QMultiHash<char, QLatin1String> &builtin,
-                  QMultiHash<char, QLatin1String> &literals,
-                  QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   C# DATA      *************************************/
-/********************************************************/
-void loadCSharpData(QMultiHash<char, QLatin1String> &types,
-                    QMultiHash<char, QLatin1String> &keywords,
-                    QMultiHash<char, QLatin1String> &builtin,
-                    QMultiHash<char, QLatin1String> &literals,
-                    QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   Go DATA      *************************************/
-/********************************************************/
-void loadGoData(QMultiHash<char, QLatin1String> &types,
-                QMultiHash<char, QLatin1String> &keywords,
-                QMultiHash<char, QLatin1String> &builtin,
-                QMultiHash<char, QLatin1String> &literals,
-                QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   V DATA      **************************************/
-/********************************************************/
-void loadVData(QMultiHash<char, QLatin1String> &types,
-               QMultiHash<char, QLatin1String> &keywords,
-               QMultiHash<char, QLatin1String> &builtin,
-               QMultiHash<char, QLatin1String> &literals,
-               QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   SQL DATA      ************************************/
-/********************************************************/
-void loadSQLData(QMultiHash<char, QLatin1String> &types,
-                 QMultiHash<char, QLatin1String> &keywords,
-                 QMultiHash<char, QLatin1String> &builtin,
-                 QMultiHash<char, QLatin1String> &literals,
-                 QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   JSON DATA      ***********************************/
-/********************************************************/
-void loadJSONData(QMultiHash<char, QLatin1String> &types,
-                  QMultiHash<char, QLatin1String> &keywords,
-                  QMultiHash<char, QLatin1String> &builtin,
-                  QMultiHash<char, QLatin1String> &literals,
-                  QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   CSS DATA      ***********************************/
-/********************************************************/
-void loadCSSData(QMultiHash<char, QLatin1String> &types,
-                 QMultiHash<char, QLatin1String> &keywords,
-                 QMultiHash<char, QLatin1String> &builtin,
-                 QMultiHash<char, QLatin1String> &literals,
-                 QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   Typescript DATA  *********************************/
-/********************************************************/
-void loadTypescriptData(QMultiHash<char, QLatin1String> &types,
-                        QMultiHash<char, QLatin1String> &keywords,
-                        QMultiHash<char, QLatin1String> &builtin,
-                        QMultiHash<char, QLatin1String> &literals,
-                        QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   YAML DATA  ***************************************/
-/********************************************************/
-void loadYAMLData(QMultiHash<char, QLatin1String> &types,
-                  QMultiHash<char, QLatin1String> &keywords,
-                  QMultiHash<char, QLatin1String> &builtin,
-                  QMultiHash<char, QLatin1String> &literals,
-                  QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   VEX DATA  ****************************************/
-/********************************************************/
-void loadVEXData(QMultiHash<char, QLatin1String> &types,
-                 QMultiHash<char, QLatin1String> &keywords,
-                 QMultiHash<char, QLatin1String> &builtin,
-                 QMultiHash<char, QLatin1String> &literals,
-                 QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   CMake DATA  **************************************/
-/********************************************************/
-void loadCMakeData(QMultiHash<char, QLatin1String> &types,
-                   QMultiHash<char, QLatin1String> &keywords,
-                   QMultiHash<char, QLatin1String> &builtin,
-                   QMultiHash<char, QLatin1String> &literals,
-                   QMultiHash<char, QLatin1String> &other);
-
-/********************************************************/
-/***   Make DATA  ***************************************/
-/********************************************************/
-void loadMakeData(QMultiHash<char, QLatin1String> &types,
-                  QMultiHash<char, QLatin1String> &keywords,
-                  QMultiHash<char, QLatin1String> &builtin,
-                  QMultiHash<char, QLatin1String> &literals,
-                  QMultiHash<char, QLatin1String> &other);
+/**
+ * @brief All the words of a language, as used by the code highlighter
+ */
+struct LanguageData {
+    LanguageKeywords types;
+    LanguageKeywords keywords;
+    LanguageKeywords builtin;
+    LanguageKeywords literals;
+    LanguageKeywords others;
+};
+
+/**
+ * The xxxLanguageData() functions return the constant data of a language
+ */
+const LanguageData &cppLanguageData();
+const LanguageData &shellLanguageData();
+const LanguageData &jsLanguageData();
+const LanguageData &phpLanguageData();
+const LanguageData &qmlLanguageData();
+const LanguageData &pythonLanguageData();
+const LanguageData &rustLanguageData();
+const LanguageData &javaLanguageData();
+const LanguageData &csharpLanguageData();
+const LanguageData &goLanguageData();
+const LanguageData &vLanguageData();
+const LanguageData &sqlLanguageData();
+const LanguageData &jsonLanguageData();
+const LanguageData &cssLanguageData();
+const LanguageData &typescriptLanguageData();
+const LanguageData &yamlLanguageData();
+const LanguageData &vexLanguageData();
+const LanguageData &cmakeLanguageData();
+const LanguageData &makeLanguageData();
 
 #endif
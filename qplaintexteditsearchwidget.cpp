@@ -15,11 +15,26 @@
 #include "qplaintexteditsearchwidget.h"
 
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QEvent>
 #include <QKeyEvent>
+#include <QMutex>
+#include <QScrollBar>
+#include <QTextBlock>
+#include <QtConcurrent>
+#include <algorithm>
 
 #include "ui_qplaintexteditsearchwidget.h"
 
+struct QPlainTextEditSearchWidget::SearchJob {
+    QMutex mutex;
+    // matches found by the worker, not yet taken by the widget
+    QVector<SearchMatch> matches;
+    bool finished = false;
+    bool truncated = false;
+    QAtomicInt canceled;
+};
+
 QPlainTextEditSearchWidget::QPlainTextEditSearchWidget(QPlainTextEdit *parent)
     : QWidget(parent),
       ui(new Ui::QPlainTextEditSearchWidget),
@@ -33,6 +48,15 @@ QPlainTextEditSearchWidget::QPlainTextEditSearchWidget(QPlainTextEdit *parent)
     ui->searchCountLabel->setEnabled(false);
     _currentSearchResult = 0;
     _searchResultCount = 0;
+    _searchMatchesRevision = -1;
+    _searchMatchesTruncated = false;
+    _backgroundSearchEnabled = false;
+    _searchTimeLimit = defaultSearchTimeLimit;
+    _searchMatchLimit = defaultSearchMatchLimit;
+    _searchJobSelectPosition = -1;
+    _searchJobSelectDown = true;
+    _visibleSearchSelectionsOnly = false;
+    _searchJobTimer.setInterval(searchJobFlushInterval);
 
     connect(ui->closeButton, &QPushButton::clicked, this,
             &QPlainTextEditSearchWidget::deactivate);
@@ -48,6 +72,12 @@ QPlainTextEditSearchWidget::QPlainTextEditSearchWidget(QPlainTextEdit *parent)
             &QPlainTextEditSearchWidget::doReplace);
     connect(ui->replaceAllButton, &QPushButton::clicked, this,
             &QPlainTextEditSearchWidget::doReplaceAll);
+    connect(_textEdit->document(), &QTextDocument::contentsChange, this,
+            &QPlainTextEditSearchWidget::updateSearchMatches);
+    connect(&_searchJobTimer, &QTimer::timeout, this,
+            &QPlainTextEditSearchWidget::takeBackgroundSearchMatches);
+    connect(_textEdit->verticalScrollBar(), &QScrollBar::valueChanged, this,
+            &QPlainTextEditSearchWidget::updateVisibleSearchExtraSelections);
 
     installEventFilter(this);
     ui->searchLineEdit->installEventFilter(this);
@@ -68,7 +98,10 @@ QPlainTextEditSearchWidget::QPlainTextEditSearchWidget(QPlainTextEdit *parent)
 #endif
 }
 
-QPlainTextEditSearchWidget::~QPlainTextEditSearchWidget() { delete ui; }
+QPlainTextEditSearchWidget::~QPlainTextEditSearchWidget() {
+    cancelBackgroundSearch();
+    delete ui;
+}
 
 void QPlainTextEditSearchWidget::activate() { activate(true); }
 
@@ -134,31 +167,96 @@ bool QPlainTextEditSearchWidget::eventFilter(QObject *obj, QEvent *event) {
 void QPlainTextEditSearchWidget::searchLineEditTextChanged(
     const QString &arg1) {
     Q_UNUSED(arg1)
+    if (_backgroundSearchEnabled) {
+        startBackgroundSearch(true);
+        return;
+    }
+
     doSearchCount();
     updateSearchExtraSelections();
-    doSearchDown();
+    searchFromSelectionStart();
 }
 
 void QPlainTextEditSearchWidget::updateSearchExtraSelections() {
     _searchExtraSelections.clear();
-    const auto textCursor = _textEdit->textCursor();
-    _textEdit->moveCursor(QTextCursor::Start);
-    const QColor color = selectionColor;
-    QTextCharFormat extraFmt;
-    extraFmt.setBackground(color);
-
-    while (doSearch(true, false, false)) {
-        QTextEdit::ExtraSelection extra = QTextEdit::ExtraSelection();
-        extra.format = extraFmt;
+    ensureSearchMatches();
+
+    int first = 0;
+    int last = _searchMatches.size();
+    if (_visibleSearchSelectionsOnly) {
+        int start;
+        int end;
+        visibleSearchRange(start, end);
+        first = searchMatchIndex(start, true);
+        if (first == -1) {
+            first = last;
+        }
+        last = int(std::lower_bound(_searchMatches.cbegin() + first,
+                                    _searchMatches.cbegin() + last, end,
+                                    [](const SearchMatch &match, int pos) {
+                                        return match.position < pos;
+                                    }) -
+                   _searchMatches.cbegin());
+    }
 
-        extra.cursor = _textEdit->textCursor();
-        _searchExtraSelections.append(extra);
+    _searchExtraSelections.reserve(last - first);
+    for (int i = first; i < last; ++i) {
+        _searchExtraSelections.append(
+            searchExtraSelection(_searchMatches.at(i)));
     }
 
-    _textEdit->setTextCursor(textCursor);
     this->setSearchExtraSelections();
 }
 
+/**
+ * @brief Returns the text range of the viewport, extended by a viewport
+ * height of blocks on both sides so small scrolls don't show gaps
+ */
+void QPlainTextEditSearchWidget::visibleSearchRange(int &start,
+                                                    int &end) const {
+    const QRect rect = _textEdit->viewport()->rect();
+    QTextBlock firstBlock =
+        _textEdit->cursorForPosition(rect.topLeft()).block();
+    QTextBlock lastBlock =
+        _textEdit->cursorForPosition(rect.bottomRight()).block();
+
+    const int margin =
+        qMax(50, lastBlock.blockNumber() - firstBlock.blockNumber() + 1);
+    for (int i = 0; i < margin && firstBlock.previous().isValid(); ++i) {
+        firstBlock = firstBlock.previous();
+    }
+    for (int i = 0; i < margin && lastBlock.next().isValid(); ++i) {
+        lastBlock = lastBlock.next();
+    }
+
+    start = firstBlock.position();
+    end = lastBlock.position() + lastBlock.length();
+}
+
+/**
+ * @brief Moves the extra selections along with the viewport
+ */
+void QPlainTextEditSearchWidget::updateVisibleSearchExtraSelections() {
+    if (!_visibleSearchSelectionsOnly || !isVisible() ||
+        _searchMatches.isEmpty()) {
+        return;
+    }
+
+    updateSearchExtraSelections();
+}
+
+QTextEdit::ExtraSelection QPlainTextEditSearchWidget::searchExtraSelection(
+    const SearchMatch &match) const {
+    QTextEdit::ExtraSelection extra = QTextEdit::ExtraSelection();
+    extra.format.setBackground(selectionColor);
+
+    extra.cursor = QTextCursor(_textEdit->document());
+    extra.cursor.setPosition(match.position);
+    extra.cursor.setPosition(match.position + match.length,
+                             QTextCursor::KeepAnchor);
+    return extra;
+}
+
 void QPlainTextEditSearchWidget::setSearchExtraSelections() const {
     this->_textEdit->setExtraSelections(this->_searchExtraSelections);
 }
@@ -167,6 +265,77 @@ void QPlainTextEditSearchWidget::doSearchUp() { doSearch(false); }
 
 void QPlainTextEditSearchWidget::doSearchDown() { doSearch(true); }
 
+/**
+ * @brief Expands the \1 to \99 back references in a replacement text
+ * @param captureCount the number of capturing groups of the expression
+ */
+static QString expandReplacement(const QString &replacement,
+                                 const QRegularExpressionMatch &match,
+                                 int captureCount) {
+    QString result;
+    result.reserve(replacement.length());
+    const int length = replacement.length();
+
+    for (int i = 0; i < length; ++i) {
+        const QChar c = replacement.at(i);
+
+        if (c == QLatin1Char('\\') && i + 1 < length &&
+            replacement.at(i + 1).isDigit()) {
+            int number = replacement.at(i + 1).digitValue();
+            int digits = 1;
+
+            if (i + 2 < length && replacement.at(i + 2).isDigit()) {
+                const int twoDigitNumber =
+                    number * 10 + replacement.at(i + 2).digitValue();
+                if (twoDigitNumber <= captureCount) {
+                    number = twoDigitNumber;
+                    digits = 2;
+                }
+            }
+
+            if (number <= captureCount) {
+                result += match.captured(number);
+                i += digits;
+                continue;
+            }
+        }
+
+        result += c;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the replacement for the regular expression match selected
+ * by cursor
+ */
+QString QPlainTextEditSearchWidget::regExpReplacement(
+    const QTextCursor &cursor) const {
+    const QRegularExpression regExp = currentSearchQuery().regExp;
+    const QString replaceText = ui->replaceLineEdit->text();
+    const QTextBlock block =
+        _textEdit->document()->findBlock(cursor.selectionStart());
+    QString blockText = block.text();
+    blockText.replace(QChar::Nbsp, QLatin1Char(' '));
+
+    // match in the block, so anchors and lookbehinds see the context
+    const QRegularExpressionMatch match = regExp.match(
+        blockText, cursor.selectionStart() - block.position(),
+        QRegularExpression::NormalMatch,
+        QRegularExpression::AnchoredMatchOption);
+
+    if (match.hasMatch() &&
+        match.capturedEnd() == cursor.selectionEnd() - block.position()) {
+        return expandReplacement(replaceText, match, regExp.captureCount());
+    }
+
+    // the selection isn't a single match, replace inside of it
+    QString text = cursor.selectedText();
+    text.replace(regExp, replaceText);
+    return text;
+}
+
 bool QPlainTextEditSearchWidget::doReplace(bool forAll) {
     if (_textEdit->isReadOnly()) {
         return false;
@@ -180,10 +349,7 @@ bool QPlainTextEditSearchWidget::doReplace(bool forAll) {
 
     const int searchMode = ui->modeComboBox->currentIndex();
     if (searchMode == RegularExpressionMode) {
-        QString text = cursor.selectedText();
-        text.replace(QRegExp(ui->searchLineEdit->text()),
-                     ui->replaceLineEdit->text());
-        cursor.insertText(text);
+        cursor.insertText(regExpReplacement(cursor));
     } else {
         cursor.insertText(ui->replaceLineEdit->text());
     }
@@ -201,17 +367,85 @@ bool QPlainTextEditSearchWidget::doReplace(bool forAll) {
     return true;
 }
 
+/**
+ * @brief Replaces all matches as a single edit
+ *
+ * The replacements are computed in one pass over the blocks with matches
+ * and applied inside of one edit block, so there is one undo step and the
+ * document only signals a single change.
+ */
 void QPlainTextEditSearchWidget::doReplaceAll() {
     if (_textEdit->isReadOnly()) {
         return;
     }
 
-    // start at the top
-    _textEdit->moveCursor(QTextCursor::Start);
+    // replacing needs all matches, not the ones a background search found
+    // so far
+    if (_searchJob || _searchMatchesTruncated || searchMatchesOutdated()) {
+        doSearchCount();
+    }
+
+    if (_searchMatches.isEmpty()) {
+        return;
+    }
+
+    QTextDocument *document = _textEdit->document();
+    const QString replaceText = ui->replaceLineEdit->text();
+    const bool isRegExp = _searchQuery.mode == RegularExpressionMode;
+    QVector<SearchMatch> matches;
+    QVector<QString> replacements;
+
+    if (isRegExp) {
+        const QRegularExpression &regExp = _searchQuery.regExp;
+        const int captureCount = regExp.captureCount();
+        matches.reserve(_searchMatches.size());
+        replacements.reserve(_searchMatches.size());
+        QTextBlock block;
+
+        // match every block with matches once more to get the captures
+        for (const SearchMatch &searchMatch : qAsConst(_searchMatches)) {
+            if (block.isValid() &&
+                searchMatch.position < block.position() + block.length()) {
+                continue;
+            }
+
+            block = document->findBlock(searchMatch.position);
+            QString blockText = block.text();
+            blockText.replace(QChar::Nbsp, QLatin1Char(' '));
+            QRegularExpressionMatchIterator iterator =
+                regExp.globalMatch(blockText);
+
+            while (iterator.hasNext()) {
+                const QRegularExpressionMatch match = iterator.next();
+                if (match.capturedLength() == 0) {
+                    continue;
+                }
+
+                matches.append(SearchMatch{
+                    block.position() + match.capturedStart(),
+                    match.capturedLength()});
+                replacements.append(
+                    expandReplacement(replaceText, match, captureCount));
+            }
+        }
+    } else {
+        matches = _searchMatches;
+    }
 
-    // replace until everything to the bottom is replaced
-    while (doSearch(true, false) && doReplace(true)) {
+    QTextCursor cursor(document);
+    cursor.beginEditBlock();
+
+    // replace from the bottom up, so the positions of the matches that are
+    // still to be replaced stay valid
+    for (int i = matches.size() - 1; i >= 0; --i) {
+        const SearchMatch &match = matches.at(i);
+        cursor.setPosition(match.position);
+        cursor.setPosition(match.position + match.length,
+                           QTextCursor::KeepAnchor);
+        cursor.insertText(isRegExp ? replacements.at(i) : replaceText);
     }
+
+    cursor.endEditBlock();
 }
 
 /**
@@ -231,133 +465,621 @@ bool QPlainTextEditSearchWidget::doSearch(bool searchDown,
         return false;
     }
 
-    const int searchMode = ui->modeComboBox->currentIndex();
-    const bool caseSensitive = ui->matchCaseSensitiveButton->isChecked();
-
-    QFlags<QTextDocument::FindFlag> options =
-        searchDown ? QTextDocument::FindFlag(0) : QTextDocument::FindBackward;
-    if (searchMode == WholeWordsMode) {
-        options |= QTextDocument::FindWholeWords;
-    }
-
-    if (caseSensitive) {
-        options |= QTextDocument::FindCaseSensitively;
-    }
-
-    bool found =
-        searchMode == RegularExpressionMode
-            ?
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 13, 0))
-            _textEdit->find(
-                QRegularExpression(
-                    text, caseSensitive
-                              ? QRegularExpression::NoPatternOption
-                              : QRegularExpression::CaseInsensitiveOption),
-                options)
-            :
-#else
-            _textEdit->find(QRegExp(text, caseSensitive ? Qt::CaseSensitive
-                                                        : Qt::CaseInsensitive),
-                            options)
-            :
-#endif
-            _textEdit->find(text, options);
+    ensureSearchMatches();
+
+    const QTextCursor cursor = _textEdit->textCursor();
+    const int position =
+        searchDown ? cursor.selectionEnd() : cursor.selectionStart();
+    int index = searchMatchIndex(position, searchDown);
+
+    // a running background search finds the matches in document order, so
+    // the next match may still come and the previous one is only known once
+    // the search got past the cursor, let it select the match then
+    if (_searchJob &&
+        (index == -1 ||
+         (!searchDown && _searchMatches.last().position < position))) {
+        _searchJobSelectPosition = position;
+        _searchJobSelectDown = searchDown;
+        return false;
+    }
+
+    // start at the top (or bottom) if not found
+    if (index == -1 && allowRestartAtTop && !_searchMatches.isEmpty()) {
+        index = searchDown ? 0 : _searchMatches.size() - 1;
+    }
+
+    const bool found = index != -1;
 
     if (found) {
-        const int result =
-            searchDown ? ++_currentSearchResult : --_currentSearchResult;
-        _currentSearchResult = std::min(result, _searchResultCount);
+        selectSearchMatch(index);
+        _currentSearchResult = index + 1;
+        updateSearchCountLabelText();
+    }
+
+    if (updateUI) {
+        updateSearchResultUI(found);
+    }
+
+    return found;
+}
+
+/**
+ * @brief Moves the search widget out of the way of the current match and
+ * colors the search line edit according to the result
+ */
+void QPlainTextEditSearchWidget::updateSearchResultUI(bool found) {
+    const QRect rect = _textEdit->cursorRect();
+    QMargins margins = _textEdit->layout()->contentsMargins();
+    const int searchWidgetHotArea = _textEdit->height() - this->height();
+    const int marginBottom =
+        (rect.y() > searchWidgetHotArea) ? (this->height() + 10) : 0;
+
+    // move the search box a bit up if we would block the search result
+    if (margins.bottom() != marginBottom) {
+        margins.setBottom(marginBottom);
+        _textEdit->layout()->setContentsMargins(margins);
+    }
+
+    // add a background color according if we found the text or not
+    const QString bgColorCode =
+        _darkMode
+            ? (found ? QStringLiteral("#135a13") : QStringLiteral("#8d2b36"))
+            : found ? QStringLiteral("#D5FAE2") : QStringLiteral("#FAE9EB");
+    const QString fgColorCode =
+        _darkMode ? QStringLiteral("#cccccc") : QStringLiteral("#404040");
 
+    ui->searchLineEdit->setStyleSheet(
+        QStringLiteral("* { background: ") + bgColorCode +
+        QStringLiteral("; color: ") + fgColorCode + QStringLiteral("; }"));
+
+    // restore the search extra selections after the find command
+    this->setSearchExtraSelections();
+}
+
+/**
+ * @brief Counts the search results
+ */
+void QPlainTextEditSearchWidget::doSearchCount() {
+    cancelBackgroundSearch();
+    buildSearchMatches();
+
+    const QTextCursor cursor = _textEdit->textCursor();
+    _searchResultCount = _searchMatches.size();
+    _currentSearchResult = cursor.hasSelection()
+                               ? searchMatchIndexAt(cursor.selectionStart()) + 1
+                               : 0;
+
+    updateSearchCountLabelText();
+}
+
+QPlainTextEditSearchWidget::SearchQuery
+QPlainTextEditSearchWidget::currentSearchQuery() const {
+    SearchQuery query;
+    query.text = ui->searchLineEdit->text();
+    query.mode = ui->modeComboBox->currentIndex();
+    query.caseSensitive = ui->matchCaseSensitiveButton->isChecked();
+
+    if (query.mode == RegularExpressionMode) {
+        query.regExp = QRegularExpression(
+            query.text, query.caseSensitive
+                            ? QRegularExpression::NoPatternOption
+                            : QRegularExpression::CaseInsensitiveOption);
+    }
+
+    return query;
+}
+
+/**
+ * @brief Scans the document once and collects all matches of the current
+ * search query
+ */
+void QPlainTextEditSearchWidget::buildSearchMatches() {
+    QTextDocument *document = _textEdit->document();
+    _searchQuery = currentSearchQuery();
+    _searchMatchesRevision = document->revision();
+    _searchMatchesTruncated = false;
+    _searchMatches.clear();
+
+    if (_searchQuery.text.isEmpty() ||
+        (_searchQuery.mode == RegularExpressionMode &&
+         !_searchQuery.regExp.isValid())) {
+        return;
+    }
+
+    for (QTextBlock block = document->begin(); block.isValid();
+         block = block.next()) {
+        findMatchesInText(block.text(), block.position(), _searchQuery,
+                          _searchMatches);
+    }
+}
+
+bool QPlainTextEditSearchWidget::searchMatchesOutdated() const {
+    return _searchMatchesRevision != _textEdit->document()->revision() ||
+           _searchQuery != currentSearchQuery();
+}
+
+/**
+ * @brief Rebuilds the match index if the query or the document changed
+ */
+void QPlainTextEditSearchWidget::ensureSearchMatches() {
+    if (searchMatchesOutdated()) {
+        if (_backgroundSearchEnabled) {
+            startBackgroundSearch(false);
+            return;
+        }
+
+        buildSearchMatches();
+        _searchResultCount = _searchMatches.size();
+    }
+}
+
+/**
+ * @brief Keeps the match index in sync with edits of the document
+ *
+ * Only the blocks touched by the edit are scanned again, the matches after
+ * them are shifted by the length difference. Matches never span blocks, so
+ * this yields the same index as a full rescan.
+ */
+void QPlainTextEditSearchWidget::updateSearchMatches(int position,
+                                                     int charsRemoved,
+                                                     int charsAdded) {
+    QTextDocument *document = _textEdit->document();
+    const int revision = document->revision();
+
+    // format changes (e.g. by the highlighter) don't touch the revision
+    if (_searchMatchesRevision == -1 || _searchMatchesRevision == revision) {
+        return;
+    }
+
+    // don't maintain the index while nobody is looking at it, it will be
+    // rebuilt on the next search
+    if (!isVisible() || _searchQuery != currentSearchQuery()) {
+        cancelBackgroundSearch();
+        _searchMatchesRevision = -1;
+        return;
+    }
+
+    // the matches of a running search refer to the old text
+    if (_searchJob) {
+        startBackgroundSearch(_searchJobSelectPosition != -1,
+                              _searchJobSelectDown);
+        return;
+    }
+
+    _searchMatchesRevision = revision;
+
+    if (_searchQuery.text.isEmpty() ||
+        (_searchQuery.mode == RegularExpressionMode &&
+         !_searchQuery.regExp.isValid())) {
+        return;
+    }
+
+    const QTextBlock startBlock = document->findBlock(position);
+    QTextBlock endBlock = document->findBlock(position + charsAdded);
+    if (!startBlock.isValid()) {
+        buildSearchMatches();
+        _searchResultCount = _searchMatches.size();
+        updateSearchExtraSelections();
         updateSearchCountLabelText();
+        return;
+    }
+    if (!endBlock.isValid()) {
+        endBlock = document->lastBlock();
     }
 
-    // start at the top (or bottom) if not found
-    if (!found && allowRestartAtTop) {
-        _textEdit->moveCursor(searchDown ? QTextCursor::Start
-                                         : QTextCursor::End);
-        found =
-            searchMode == RegularExpressionMode
-                ?
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 13, 0))
-                _textEdit->find(
-                    QRegularExpression(
-                        text, caseSensitive
-                                  ? QRegularExpression::NoPatternOption
-                                  : QRegularExpression::CaseInsensitiveOption),
-                    options)
-                :
-#else
-                _textEdit->find(
-                    QRegExp(text, caseSensitive ? Qt::CaseSensitive
-                                                : Qt::CaseInsensitive),
-                    options)
-                :
-#endif
-                _textEdit->find(text, options);
+    const int windowStart = startBlock.position();
+    const int windowEnd = endBlock.position() + endBlock.length();
+    const int delta = charsAdded - charsRemoved;
 
-        if (found && updateUI) {
-            _currentSearchResult = searchDown ? 1 : _searchResultCount;
-            updateSearchCountLabelText();
+    QVector<SearchMatch> windowMatches;
+    for (QTextBlock block = startBlock; block.isValid(); block = block.next()) {
+        findMatchesInText(block.text(), block.position(), _searchQuery,
+                          windowMatches);
+        if (block == endBlock) {
+            break;
         }
     }
 
-    if (updateUI) {
-        const QRect rect = _textEdit->cursorRect();
-        QMargins margins = _textEdit->layout()->contentsMargins();
-        const int searchWidgetHotArea = _textEdit->height() - this->height();
-        const int marginBottom =
-            (rect.y() > searchWidgetHotArea) ? (this->height() + 10) : 0;
-
-        // move the search box a bit up if we would block the search result
-        if (margins.bottom() != marginBottom) {
-            margins.setBottom(marginBottom);
-            _textEdit->layout()->setContentsMargins(margins);
+    // the matches of the touched blocks, in positions before the edit
+    int firstIndex = searchMatchIndex(windowStart, true);
+    if (firstIndex == -1) {
+        firstIndex = _searchMatches.size();
+    }
+    int lastIndex = firstIndex;
+    while (lastIndex < _searchMatches.size() &&
+           _searchMatches.at(lastIndex).position < windowEnd - delta) {
+        ++lastIndex;
+    }
+
+    const bool extraSelectionsInSync =
+        !_visibleSearchSelectionsOnly &&
+        _searchExtraSelections.size() == _searchMatches.size();
+
+    QVector<SearchMatch> matches;
+    matches.reserve(_searchMatches.size() - (lastIndex - firstIndex) +
+                    windowMatches.size());
+    matches += _searchMatches.mid(0, firstIndex);
+    matches += windowMatches;
+    for (int i = lastIndex; i < _searchMatches.size(); ++i) {
+        SearchMatch match = _searchMatches.at(i);
+        match.position += delta;
+        matches.append(match);
+    }
+    _searchMatches = matches;
+    _searchResultCount = _searchMatches.size();
+
+    if (extraSelectionsInSync) {
+        // the cursors of the other extra selections follow the edit by
+        // themselves, only the ones of the touched blocks need replacing
+        for (int i = firstIndex; i < lastIndex; ++i) {
+            _searchExtraSelections.removeAt(firstIndex);
         }
+        for (int i = 0; i < windowMatches.size(); ++i) {
+            _searchExtraSelections.insert(
+                firstIndex + i, searchExtraSelection(windowMatches.at(i)));
+        }
+        setSearchExtraSelections();
+    } else {
+        updateSearchExtraSelections();
+    }
 
-        // add a background color according if we found the text or not
-        const QString bgColorCode =
-            _darkMode
-                ? (found ? QStringLiteral("#135a13")
-                         : QStringLiteral("#8d2b36"))
-                : found ? QStringLiteral("#D5FAE2") : QStringLiteral("#FAE9EB");
-        const QString fgColorCode =
-            _darkMode ? QStringLiteral("#cccccc") : QStringLiteral("#404040");
+    _currentSearchResult = std::min(_currentSearchResult, _searchResultCount);
+    updateSearchCountLabelText();
+}
 
-        ui->searchLineEdit->setStyleSheet(
-            QStringLiteral("* { background: ") + bgColorCode +
-            QStringLiteral("; color: ") + fgColorCode + QStringLiteral("; }"));
+/**
+ * @brief Searches a snapshot of the document in the thread pool
+ *
+ * The matches are collected by takeBackgroundSearchMatches() while the
+ * search is running, a newer search cancels this one.
+ *
+ * @param selectMatch select the first match at or after the current
+ * selection once it is found
+ * @param searchDown select the last match before the selection instead if
+ * false, once the search got past it
+ */
+void QPlainTextEditSearchWidget::startBackgroundSearch(bool selectMatch,
+                                                       bool searchDown) {
+    cancelBackgroundSearch();
+
+    QTextDocument *document = _textEdit->document();
+    _searchQuery = currentSearchQuery();
+    _searchMatchesRevision = document->revision();
+    _searchMatchesTruncated = false;
+    _searchMatches.clear();
+    _searchExtraSelections.clear();
+    setSearchExtraSelections();
+    _searchResultCount = 0;
+    _currentSearchResult = 0;
 
-        // restore the search extra selections after the find command
-        this->setSearchExtraSelections();
+    if (_searchQuery.text.isEmpty() ||
+        (_searchQuery.mode == RegularExpressionMode &&
+         !_searchQuery.regExp.isValid())) {
+        updateSearchCountLabelText();
+        if (selectMatch) {
+            if (_searchQuery.text.isEmpty()) {
+                ui->searchLineEdit->setStyleSheet(QLatin1String(""));
+            } else {
+                updateSearchResultUI(false);
+            }
+        }
+        return;
     }
 
-    return found;
+    _searchJobSelectPosition =
+        selectMatch ? _textEdit->textCursor().selectionStart() : -1;
+    _searchJobSelectDown = searchDown;
+
+    // toPlainText() separates the blocks with a single character like the
+    // block positions do and already turns non-breaking spaces into spaces
+    const QString text = document->toPlainText();
+    const SearchQuery query = _searchQuery;
+    const int timeLimit = _searchTimeLimit;
+    const int matchLimit = _searchMatchLimit;
+    QSharedPointer<SearchJob> job(new SearchJob);
+    _searchJob = job;
+
+    QtConcurrent::run([job, text, query, timeLimit, matchLimit]() {
+        runBackgroundSearch(job, text, query, timeLimit, matchLimit);
+    });
+
+    _searchJobTimer.start();
+    updateSearchCountLabelText();
+}
+
+void QPlainTextEditSearchWidget::cancelBackgroundSearch() {
+    if (!_searchJob) {
+        return;
+    }
+
+    _searchJob->canceled.storeRelease(1);
+    _searchJob.reset();
+    _searchJobTimer.stop();
+    _searchJobSelectPosition = -1;
 }
 
 /**
- * @brief Counts the search results
+ * @brief Scans text line by line and hands the matches to job in chunks
+ *
+ * Runs in a worker thread. It stops early if the job is canceled or one of
+ * the limits (0 for none) is reached. A single match of a catastrophic
+ * regular expression can't be interrupted, but it only blocks the worker.
  */
-void QPlainTextEditSearchWidget::doSearchCount() {
-    // Note that we are moving the anchor, so the search will start from the top
-    // again! Alternative: Restore cursor position afterwards, but then we will
-    // not know
-    //              at what _currentSearchResult we currently are
-    _textEdit->moveCursor(QTextCursor::Start, QTextCursor::MoveAnchor);
+void QPlainTextEditSearchWidget::runBackgroundSearch(
+    QSharedPointer<SearchJob> job, const QString &text,
+    const SearchQuery &query, int timeLimit, int matchLimit) {
+    QElapsedTimer timer;
+    timer.start();
+    qint64 lastFlush = -searchJobFlushInterval;
+    QVector<SearchMatch> chunk;
+    int matchCount = 0;
+    bool truncated = false;
+    int lineStart = 0;
+
+    while (lineStart <= text.length()) {
+        if (job->canceled.loadAcquire()) {
+            return;
+        }
 
-    bool found;
-    _searchResultCount = 0;
-    _currentSearchResult = 0;
+        int lineEnd = text.indexOf(QLatin1Char('\n'), lineStart);
+        if (lineEnd == -1) {
+            lineEnd = text.length();
+        }
+
+        findMatchesInText(text.mid(lineStart, lineEnd - lineStart), lineStart,
+                          query, chunk);
+        lineStart = lineEnd + 1;
+
+        if (matchLimit > 0 && matchCount + chunk.size() >= matchLimit) {
+            chunk.resize(matchLimit - matchCount);
+            truncated = lineStart <= text.length();
+        } else if (timeLimit > 0 && timer.elapsed() > timeLimit) {
+            truncated = lineStart <= text.length();
+        }
+
+        const bool done = truncated || lineStart > text.length();
+
+        // hand over the first matches right away, later ones in chunks
+        if (done || (!chunk.isEmpty() &&
+                     timer.elapsed() - lastFlush >= searchJobFlushInterval)) {
+            QMutexLocker locker(&job->mutex);
+            job->matches += chunk;
+            job->finished = done;
+            job->truncated = truncated;
+            matchCount += chunk.size();
+            chunk.clear();
+            lastFlush = timer.elapsed();
+        }
+
+        if (done) {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Adds the matches the background search found so far to the index
+ */
+void QPlainTextEditSearchWidget::takeBackgroundSearchMatches() {
+    if (!_searchJob) {
+        _searchJobTimer.stop();
+        return;
+    }
 
-    do {
-        found = doSearch(true, false, false);
-        if (found) {
-            _searchResultCount++;
+    QVector<SearchMatch> matches;
+    bool finished;
+    {
+        QMutexLocker locker(&_searchJob->mutex);
+        matches.swap(_searchJob->matches);
+        finished = _searchJob->finished;
+        _searchMatchesTruncated = _searchJob->truncated;
+    }
+
+    if (!_visibleSearchSelectionsOnly) {
+        for (const SearchMatch &match : qAsConst(matches)) {
+            _searchExtraSelections.append(searchExtraSelection(match));
+        }
+    }
+    _searchMatches += matches;
+    _searchResultCount = _searchMatches.size();
+
+    if (finished) {
+        _searchJob.reset();
+        _searchJobTimer.stop();
+    }
+
+    if (!matches.isEmpty()) {
+        if (_visibleSearchSelectionsOnly) {
+            updateSearchExtraSelections();
+        } else {
+            setSearchExtraSelections();
+        }
+    }
+
+    if (_searchJobSelectPosition != -1) {
+        const int position = _searchJobSelectPosition;
+        int index = searchMatchIndex(position, _searchJobSelectDown);
+
+        // a match before the cursor may still be followed by a closer one
+        if (!_searchJobSelectDown && !finished && index != -1 &&
+            _searchMatches.last().position < position) {
+            index = -1;
+        }
+
+        // start at the top (or bottom) if there was no match below (or
+        // above) the cursor
+        if (index == -1 && finished && !_searchMatches.isEmpty()) {
+            index = _searchJobSelectDown ? 0 : _searchMatches.size() - 1;
+        }
+
+        if (index != -1) {
+            _searchJobSelectPosition = -1;
+            selectSearchMatch(index);
+            _currentSearchResult = index + 1;
+            updateSearchResultUI(true);
+        } else if (finished) {
+            _searchJobSelectPosition = -1;
+            updateSearchResultUI(false);
         }
-    } while (found);
+    }
 
     updateSearchCountLabelText();
 }
 
+/**
+ * @brief Appends the matches of query in the text of a single block
+ * @param offset the document position of the block
+ */
+void QPlainTextEditSearchWidget::findMatchesInText(
+    const QString &text, int offset, const SearchQuery &query,
+    QVector<SearchMatch> &matches) {
+    // QTextDocument::find() treats non-breaking spaces as normal spaces
+    QString blockText = text;
+    blockText.replace(QChar::Nbsp, QLatin1Char(' '));
+
+    if (query.mode == RegularExpressionMode) {
+        QRegularExpressionMatchIterator iterator =
+            query.regExp.globalMatch(blockText);
+
+        while (iterator.hasNext()) {
+            const QRegularExpressionMatch match = iterator.next();
+
+            // empty matches can neither be selected nor highlighted
+            if (match.capturedLength() > 0) {
+                matches.append(SearchMatch{offset + match.capturedStart(),
+                                           match.capturedLength()});
+            }
+        }
+
+        return;
+    }
+
+    const Qt::CaseSensitivity caseSensitivity =
+        query.caseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive;
+    const int length = query.text.length();
+    int index = blockText.indexOf(query.text, 0, caseSensitivity);
+
+    while (index != -1) {
+        if (query.mode == WholeWordsMode) {
+            const int end = index + length;
+            const bool isWholeWord =
+                (index == 0 || !blockText.at(index - 1).isLetterOrNumber()) &&
+                (end >= blockText.length() ||
+                 !blockText.at(end).isLetterOrNumber());
+
+            if (!isWholeWord) {
+                index = blockText.indexOf(query.text, index + 1,
+                                          caseSensitivity);
+                continue;
+            }
+        }
+
+        matches.append(SearchMatch{offset + index, length});
+        index = blockText.indexOf(query.text, index + length, caseSensitivity);
+    }
+}
+
+/**
+ * @brief Looks up the next (or previous) match in the match index
+ * @param position the document position to search from
+ * @returns the index of the match or -1 if there is none
+ */
+int QPlainTextEditSearchWidget::searchMatchIndex(int position,
+                                                 bool searchDown) const {
+    const auto it = std::lower_bound(
+        _searchMatches.constBegin(), _searchMatches.constEnd(), position,
+        [](const SearchMatch &match, int pos) { return match.position < pos; });
+    const int index = static_cast<int>(it - _searchMatches.constBegin());
+
+    if (searchDown) {
+        return index < _searchMatches.size() ? index : -1;
+    }
+
+    return index - 1;
+}
+
+/**
+ * @returns the index of the match that starts at position or -1
+ */
+int QPlainTextEditSearchWidget::searchMatchIndexAt(int position) const {
+    const int index = searchMatchIndex(position, true);
+
+    return index != -1 && _searchMatches.at(index).position == position ? index
+                                                                        : -1;
+}
+
+void QPlainTextEditSearchWidget::selectSearchMatch(int index) {
+    const SearchMatch &match = _searchMatches.at(index);
+    QTextCursor cursor = _textEdit->textCursor();
+    cursor.setPosition(match.position);
+    cursor.setPosition(match.position + match.length, QTextCursor::KeepAnchor);
+    _textEdit->setTextCursor(cursor);
+}
+
+/**
+ * @brief Selects the first match at or after the start of the current
+ * selection, so a match that is extended while typing stays selected
+ */
+void QPlainTextEditSearchWidget::searchFromSelectionStart() {
+    QTextCursor cursor = _textEdit->textCursor();
+    cursor.setPosition(cursor.selectionStart());
+    _textEdit->setTextCursor(cursor);
+    doSearchDown();
+}
+
+/**
+ * @brief Runs searches in the background for large documents
+ *
+ * The count and the highlights are updated while the search is running,
+ * typing cancels a running search.
+ */
+void QPlainTextEditSearchWidget::setBackgroundSearchEnabled(bool enabled) {
+    _backgroundSearchEnabled = enabled;
+}
+
+bool QPlainTextEditSearchWidget::backgroundSearchEnabled() const {
+    return _backgroundSearchEnabled;
+}
+
+/**
+ * @brief Only highlights the matches in and around the viewport, for
+ * searches with a huge number of matches
+ *
+ * The highlights follow the viewport when scrolling, the count still
+ * covers the whole document.
+ */
+void QPlainTextEditSearchWidget::setVisibleSearchSelectionsOnly(bool enabled) {
+    if (_visibleSearchSelectionsOnly == enabled) {
+        return;
+    }
+
+    _visibleSearchSelectionsOnly = enabled;
+
+    if (isVisible() && !_searchMatches.isEmpty()) {
+        updateSearchExtraSelections();
+    }
+}
+
+bool QPlainTextEditSearchWidget::visibleSearchSelectionsOnly() const {
+    return _visibleSearchSelectionsOnly;
+}
+
+/**
+ * @brief Sets the time after which a background search stops
+ * @param msec 0 for no limit
+ */
+void QPlainTextEditSearchWidget::setSearchTimeLimit(int msec) {
+    _searchTimeLimit = msec;
+}
+
+/**
+ * @brief Sets the number of matches after which a background search stops
+ * @param count 0 for no limit
+ */
+void QPlainTextEditSearchWidget::setSearchMatchLimit(int count) {
+    _searchMatchLimit = count;
+}
+
 void QPlainTextEditSearchWidget::setDarkMode(bool enabled) {
     _darkMode = enabled;
 }
@@ -399,11 +1121,18 @@ void QPlainTextEditSearchWidget::reset() {
 
 void QPlainTextEditSearchWidget::updateSearchCountLabelText() {
     ui->searchCountLabel->setEnabled(true);
-    ui->searchCountLabel->setText(QString("%1/%2").arg(
+
+    // a running or cut short search may have more results
+    const QString more = _searchJob || _searchMatchesTruncated
+                             ? QStringLiteral("+")
+                             : QString();
+
+    ui->searchCountLabel->setText(QString("%1/%2%3").arg(
         _currentSearchResult == 0 ? QChar('-')
                                   : QString::number(_currentSearchResult),
         _searchResultCount == 0 ? QChar('-')
-                                : QString::number(_searchResultCount)));
+                                : QString::number(_searchResultCount),
+        more));
 }
 
 void QPlainTextEditSearchWidget::setSearchSelectionColor(const QColor &color) {
@@ -413,13 +1142,11 @@ void QPlainTextEditSearchWidget::setSearchSelectionColor(const QColor &color) {
 void QPlainTextEditSearchWidget::on_modeComboBox_currentIndexChanged(
     int index) {
     Q_UNUSED(index)
-    doSearchCount();
-    doSearchDown();
+    searchLineEditTextChanged(ui->searchLineEdit->text());
 }
 
 void QPlainTextEditSearchWidget::on_matchCaseSensitiveButton_toggled(
     bool checked) {
     Q_UNUSED(checked)
-    doSearchCount();
-    doSearchDown();
+    searchLineEditTextChanged(ui->searchLineEdit->text());
 }
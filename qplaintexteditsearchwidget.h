@@ -15,6 +15,10 @@
 #pragma once
 
 #include <QPlainTextEdit>
+#include <QRegularExpression>
+#include <QSharedPointer>
+#include <QTimer>
+#include <QVector>
 #include <QWidget>
 
 namespace Ui {
@@ -35,16 +39,95 @@ class QPlainTextEditSearchWidget : public QWidget {
     void setSearchText(const QString &searchText);
     void setSearchMode(SearchMode searchMode);
     void activate(bool focus);
+    void setBackgroundSearchEnabled(bool enabled);
+    bool backgroundSearchEnabled() const;
+    void setSearchTimeLimit(int msec);
+    void setSearchMatchLimit(int count);
+    void setVisibleSearchSelectionsOnly(bool enabled);
+    bool visibleSearchSelectionsOnly() const;
 
    private:
+    struct SearchMatch {
+        int position;
+        int length;
+    };
+
+    /**
+     * The search text, mode and case sensitivity a match index was built for
+     */
+    struct SearchQuery {
+        QString text;
+        int mode = PlainTextMode;
+        bool caseSensitive = false;
+        QRegularExpression regExp;
+
+        bool operator==(const SearchQuery &other) const {
+            return text == other.text && mode == other.mode &&
+                   caseSensitive == other.caseSensitive;
+        }
+        bool operator!=(const SearchQuery &other) const {
+            return !(*this == other);
+        }
+    };
+
+    // shared between the widget and a background search worker
+    struct SearchJob;
+
     Ui::QPlainTextEditSearchWidget *ui;
     int _searchResultCount;
     int _currentSearchResult;
     QList<QTextEdit::ExtraSelection> _searchExtraSelections;
     QColor selectionColor;
 
+    // all matches of _searchQuery in the document, sorted by position
+    QVector<SearchMatch> _searchMatches;
+    SearchQuery _searchQuery;
+    // document revision _searchMatches was built for, -1 if there is none
+    int _searchMatchesRevision;
+    // true if a search limit cut the index short
+    bool _searchMatchesTruncated;
+
+    bool _backgroundSearchEnabled;
+    int _searchTimeLimit;
+    int _searchMatchLimit;
+    QSharedPointer<SearchJob> _searchJob;
+    QTimer _searchJobTimer;
+    // position to select the first match from once the background search
+    // found one, -1 if nothing is to be selected
+    int _searchJobSelectPosition;
+    // the match is looked for below the position, or above it
+    bool _searchJobSelectDown;
+    // only the matches around the viewport get extra selections
+    bool _visibleSearchSelectionsOnly;
+
+    static constexpr int defaultSearchTimeLimit = 10000;
+    static constexpr int defaultSearchMatchLimit = 100000;
+    static constexpr int searchJobFlushInterval = 20;
+
     void updateSearchExtraSelections();
+    void visibleSearchRange(int &start, int &end) const;
     void setSearchExtraSelections() const;
+    QTextEdit::ExtraSelection searchExtraSelection(
+        const SearchMatch &match) const;
+    SearchQuery currentSearchQuery() const;
+    void buildSearchMatches();
+    bool searchMatchesOutdated() const;
+    void ensureSearchMatches();
+    static void findMatchesInText(const QString &text, int offset,
+                                  const SearchQuery &query,
+                                  QVector<SearchMatch> &matches);
+    int searchMatchIndex(int position, bool searchDown) const;
+    int searchMatchIndexAt(int position) const;
+    void selectSearchMatch(int index);
+    void searchFromSelectionStart();
+    void updateSearchResultUI(bool found);
+    QString regExpReplacement(const QTextCursor &cursor) const;
+    void startBackgroundSearch(bool selectMatch, bool searchDown = true);
+    void cancelBackgroundSearch();
+    static void runBackgroundSearch(QSharedPointer<SearchJob> job,
+                                    const QString &text,
+                                    const SearchQuery &query, int timeLimit,
+                                    int matchLimit);
 
    protected:
     QPlainTextEdit *_textEdit;
@@ -68,6 +151,9 @@ class QPlainTextEditSearchWidget : public QWidget {
     void updateSearchCountLabelText();
     void setSearchSelectionColor(const QColor &color);
    private slots:
+    void updateSearchMatches(int position, int charsRemoved, int charsAdded);
+    void takeBackgroundSearchMatches();
+    void updateVisibleSearchExtraSelections();
     void on_modeComboBox_currentIndexChanged(int index);
     void on_matchCaseSensitiveButton_toggled(bool checked);
 };